@@ -0,0 +1,743 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2015 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+/**************************  Fraunhofer IIS FDK Tools  ***********************
+
+   Author(s):
+   Description: Micro benchmark of the codec kernels and of complete encode and
+                decode frames on deterministic synthetic input.
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "aacenc_lib.h"
+#include "aacdecoder_lib.h"
+
+#include "FDK_cpu.h"
+#include "FDK_tools_rom.h"
+#include "FDK_hybrid.h"
+#include "fft.h"
+#include "dct.h"
+#include "mdct.h"
+#include "qmf.h"
+
+/* encoder internals */
+#include "quantize.h"
+#include "bit_cnt.h"
+
+/* decoder internals */
+#include "block.h"
+
+
+/* Kernel rates are reported for one channel at this sampling rate. */
+#define BENCH_SAMPLE_RATE  ( 48000 )
+
+/* Quantizer step size resulting in values up to the escape code book range. */
+#define BENCH_GLOBAL_GAIN  ( -36 )
+
+
+static UINT benchSeed;
+
+/* Deterministic pseudo random number in the range -32768 ... 32767. */
+static INT benchRand(void)
+{
+  benchSeed = benchSeed * 1664525 + 1013904223;
+  return (INT)(benchSeed >> 16) - 32768;
+}
+
+static void benchReport(const char *name, const UINT64 ns, const INT frames, const INT samplesPerFrame, const INT sampleRate)
+{
+  double nsPerFrame = (double)ns / (double)frames;
+
+  if (samplesPerFrame > 0) {
+    printf("%-32s %12.0f ns/frame %10.1f x realtime\n", name, nsPerFrame,
+           (1e9 * samplesPerFrame / sampleRate) / nsPerFrame);
+  } else {
+    printf("%-32s %12.0f ns/call\n", name, nsPerFrame);
+  }
+}
+
+
+/*
+ * FDK tools kernels
+ */
+
+static void benchFft(const INT iterations)
+{
+  static const INT lengths[] = { 3, 4, 5, 8, 15, 16, 32, 60, 64, 240, 256, 480, 512 };
+  FIXP_DBL src[2*512], buf[2*512];
+  char name[64];
+  UINT i;
+  INT it, n;
+
+  for (i = 0; i < sizeof(lengths)/sizeof(lengths[0]); i++) {
+    INT length = lengths[i];
+    UINT64 t;
+
+    for (n = 0; n < 2*length; n++) {
+      src[n] = (FIXP_DBL)(benchRand() << 12);
+    }
+
+    t = FDKprofileNow();
+    for (it = 0; it < iterations; it++) {
+      INT scale = 0;
+      FDKmemcpy(buf, src, 2*length*sizeof(FIXP_DBL));
+      fft(length, buf, &scale);
+    }
+    t = FDKprofileNow() - t;
+
+    sprintf(name, "fft %d", length);
+    benchReport(name, t, iterations, 0, 0);
+  }
+}
+
+static void benchDct(const INT iterations)
+{
+  static const INT lengths[] = { 128, 480, 512, 1024 };
+  FIXP_DBL src[1024], buf[1024];
+  char name[64];
+  UINT i;
+  INT it, n;
+
+  for (i = 0; i < sizeof(lengths)/sizeof(lengths[0]); i++) {
+    INT length = lengths[i];
+    UINT64 t;
+
+    for (n = 0; n < length; n++) {
+      src[n] = (FIXP_DBL)(benchRand() << 12);
+    }
+
+    t = FDKprofileNow();
+    for (it = 0; it < iterations; it++) {
+      INT scale = 0;
+      FDKmemcpy(buf, src, length*sizeof(FIXP_DBL));
+      dct_IV(buf, length, &scale);
+    }
+    t = FDKprofileNow() - t;
+
+    sprintf(name, "dct_IV %d", length);
+    benchReport(name, t, iterations, length, BENCH_SAMPLE_RATE);
+  }
+}
+
+static void benchImdct(const INT iterations)
+{
+  static const struct {
+    const char *name;
+    INT         tl;
+    INT         nSpec;
+  } cfg[] = {
+    { "imdct_block 1024",     1024, 1 },
+    { "imdct_block 8x128",     128, 8 },
+    { "imdct_block 512",       512, 1 },
+    { "imdct_block 480",       480, 1 }
+  };
+  mdct_t   mdct;
+  FIXP_DBL overlap[2*1024];
+  FIXP_DBL src[1024], spec[1024], out[1024];
+  SHORT    specScale[8];
+  UINT i;
+  INT it, n;
+
+  for (n = 0; n < 1024; n++) {
+    src[n] = (FIXP_DBL)(benchRand() << 8);
+  }
+  FDKmemclear(specScale, sizeof(specScale));
+
+  for (i = 0; i < sizeof(cfg)/sizeof(cfg[0]); i++) {
+    const FIXP_WTP *slope = FDKgetWindowSlope(cfg[i].tl, 0);
+    INT frameLength = cfg[i].tl * cfg[i].nSpec;
+    UINT64 t;
+
+    FDKmemclear(overlap, sizeof(overlap));
+    mdct_init(&mdct, overlap, sizeof(overlap)/sizeof(FIXP_DBL));
+
+    t = FDKprofileNow();
+    for (it = 0; it < iterations; it++) {
+      FDKmemcpy(spec, src, frameLength*sizeof(FIXP_DBL));
+      imdct_block(&mdct, out, spec, specScale, cfg[i].nSpec, frameLength,
+                  cfg[i].tl, slope, cfg[i].tl, slope, cfg[i].tl, (FIXP_DBL)0);
+    }
+    t = FDKprofileNow() - t;
+
+    benchReport(cfg[i].name, t, iterations, frameLength, BENCH_SAMPLE_RATE);
+  }
+}
+
+/* One SBR frame: 32 time slots of 32 analysis and 64 synthesis bands. */
+static void benchQmf(const INT iterations)
+{
+  QMF_FILTER_BANK  ana, syn;
+  QMF_SCALE_FACTOR scaleFactor;
+  FIXP_QAS         anaStates[10*32];
+  FIXP_QSS         synStates[10*64-64];
+  FIXP_QMF         qmfReal[32][64], qmfImag[32][64];
+  FIXP_QMF        *pQmfReal[32], *pQmfImag[32];
+  FIXP_QMF         work[2*64];
+  INT_PCM          timeIn[32*32], timeOut[32*64];
+  FDK_ANA_HYB_FILTER hyb;
+  FIXP_DBL         hybLF[2*3*13], hybHF[2*6*(64-3)];
+  FIXP_DBL         hybReal[71], hybImag[71];
+  UINT64 t;
+  INT it, n;
+
+  for (n = 0; n < 32; n++) {
+    pQmfReal[n] = qmfReal[n];
+    pQmfImag[n] = qmfImag[n];
+  }
+  for (n = 0; n < 32*32; n++) {
+    timeIn[n] = (INT_PCM)((benchRand() >> 2) << (SAMPLE_BITS-16));
+  }
+  FDKmemclear(qmfReal, sizeof(qmfReal));
+  FDKmemclear(qmfImag, sizeof(qmfImag));
+  FDKmemclear(&scaleFactor, sizeof(scaleFactor));
+  FDKmemclear(&ana, sizeof(ana));
+  FDKmemclear(&syn, sizeof(syn));
+
+  qmfInitAnalysisFilterBank(&ana, anaStates, 32, 32, 32, 32, 0);
+  qmfInitSynthesisFilterBank(&syn, synStates, 32, 32, 64, 64, 0);
+
+  t = FDKprofileNow();
+  for (it = 0; it < iterations; it++) {
+    qmfAnalysisFiltering(&ana, pQmfReal, pQmfImag, &scaleFactor, timeIn, 1, work);
+  }
+  t = FDKprofileNow() - t;
+  benchReport("qmfAnalysisFiltering 32", t, iterations, 32*32, BENCH_SAMPLE_RATE);
+
+  t = FDKprofileNow();
+  for (it = 0; it < iterations; it++) {
+    qmfSynthesisFiltering(&syn, pQmfReal, pQmfImag, &scaleFactor, 0, timeOut, 1, work);
+  }
+  t = FDKprofileNow() - t;
+  benchReport("qmfSynthesisFiltering 64", t, iterations, 32*64, BENCH_SAMPLE_RATE);
+
+  FDKhybridAnalysisOpen(&hyb, hybLF, sizeof(hybLF), hybHF, sizeof(hybHF));
+  FDKhybridAnalysisInit(&hyb, THREE_TO_TEN, 64, 64, 1);
+
+  t = FDKprofileNow();
+  for (it = 0; it < iterations; it++) {
+    for (n = 0; n < 32; n++) {
+      FDKhybridAnalysisApply(&hyb, qmfReal[n], qmfImag[n], hybReal, hybImag);
+    }
+  }
+  t = FDKprofileNow() - t;
+  benchReport("FDKhybridAnalysisApply 32x64", t, iterations, 32*64, BENCH_SAMPLE_RATE);
+}
+
+
+/*
+ * Quantization and noiseless coding of one long block
+ */
+
+static INT benchSpectrum(const INT iterations)
+{
+  SamplingRateInfo samplingRateInfo;
+  CAacDecoderChannelInfo channelInfo;
+  CAacDecoderDynamicData dynData;
+  FDK_BITSTREAM bs;
+  UCHAR    bsBuffer[8192];
+  FIXP_DBL mdctSpectrum[1024];
+  SPECTRUM decSpectrum;
+  SHORT    quantSpectrum[1024];
+  INT      sfbOffset[MAX_SFB_LONG+1], scalefactors[MAX_SFB_LONG], maxValue[MAX_SFB_LONG];
+  INT      bitCountLut[CODE_BOOK_ESC_NDX+1];
+  INT      nBands, nLines, nBits, sfb, it, n;
+  UINT64   t;
+
+  getSamplingRateInfo(&samplingRateInfo, 1024, 3, 48000);
+  nBands = samplingRateInfo.NumberOfScaleFactorBands_Long;
+  for (sfb = 0; sfb <= nBands; sfb++) {
+    sfbOffset[sfb] = samplingRateInfo.ScaleFactorBands_Long[sfb];
+  }
+  nLines = sfbOffset[nBands];
+
+  /* spectrum falling off towards high frequencies */
+  for (n = 0; n < 1024; n++) {
+    mdctSpectrum[n] = (FIXP_DBL)(benchRand() << (14 - (n >> 7)));
+  }
+  FDKmemclear(scalefactors, sizeof(scalefactors));
+  FDKmemclear(quantSpectrum, sizeof(quantSpectrum));
+
+  t = FDKprofileNow();
+  for (it = 0; it < iterations; it++) {
+    FDKaacEnc_QuantizeSpectrum(nBands, nBands, nBands, sfbOffset, mdctSpectrum, BENCH_GLOBAL_GAIN, scalefactors,
+                               quantSpectrum, 0, NULL, NULL);
+  }
+  t = FDKprofileNow() - t;
+  benchReport("FDKaacEnc_QuantizeSpectrum", t, iterations, 1024, BENCH_SAMPLE_RATE);
+
+  for (sfb = 0; sfb < nBands; sfb++) {
+    maxValue[sfb] = 0;
+    for (n = sfbOffset[sfb]; n < sfbOffset[sfb+1]; n++) {
+      maxValue[sfb] = fixMax(maxValue[sfb], fixp_abs((INT)quantSpectrum[n]));
+    }
+  }
+
+  t = FDKprofileNow();
+  for (it = 0; it < iterations; it++) {
+    for (sfb = 0; sfb < nBands; sfb++) {
+      FDKaacEnc_bitCount(quantSpectrum + sfbOffset[sfb], sfbOffset[sfb+1] - sfbOffset[sfb], maxValue[sfb], bitCountLut);
+    }
+  }
+  t = FDKprofileNow() - t;
+  benchReport("FDKaacEnc_bitCount", t, iterations, 1024, BENCH_SAMPLE_RATE);
+
+  /* Code each band with its cheapest code book. */
+  FDKmemclear(&dynData, sizeof(dynData));
+  FDKinitBitStream(&bs, bsBuffer, sizeof(bsBuffer), 0, BS_WRITER);
+  for (sfb = 0; sfb < nBands; sfb++) {
+    INT cb, codeBook = 0;
+
+    FDKaacEnc_bitCount(quantSpectrum + sfbOffset[sfb], sfbOffset[sfb+1] - sfbOffset[sfb], maxValue[sfb], bitCountLut);
+    for (cb = 1; cb <= CODE_BOOK_ESC_NDX; cb++) {
+      if (bitCountLut[cb] < bitCountLut[codeBook]) {
+        codeBook = cb;
+      }
+    }
+    dynData.aCodeBook[sfb] = (UCHAR)codeBook;
+    FDKaacEnc_codeValues(quantSpectrum + sfbOffset[sfb], sfbOffset[sfb+1] - sfbOffset[sfb], codeBook, &bs);
+  }
+  FDKsyncCache(&bs);
+  nBits = FDKgetValidBits(&bs);
+
+  FDKmemclear(&channelInfo, sizeof(channelInfo));
+  channelInfo.pSpectralCoefficient       = decSpectrum;
+  channelInfo.granuleLength              = 1024;
+  channelInfo.pDynData                   = &dynData;
+  channelInfo.icsInfo.WindowSequence     = OnlyLongSequence;
+  channelInfo.icsInfo.WindowGroups       = 1;
+  channelInfo.icsInfo.WindowGroupLength[0] = 1;
+  channelInfo.icsInfo.MaxSfBands         = (UCHAR)nBands;
+  channelInfo.icsInfo.TotalSfBands       = (UCHAR)nBands;
+  channelInfo.icsInfo.Valid              = 1;
+
+  t = FDKprofileNow();
+  for (it = 0; it < iterations; it++) {
+    FDKinitBitStream(&bs, bsBuffer, sizeof(bsBuffer), nBits, BS_READER);
+    CBlock_ReadSpectralData(&bs, &channelInfo, &samplingRateInfo, 0);
+  }
+  t = FDKprofileNow() - t;
+  benchReport("CBlock_ReadSpectralData", t, iterations, 1024, BENCH_SAMPLE_RATE);
+
+  for (n = 0; n < nLines; n++) {
+    if (decSpectrum[n] != (FIXP_DBL)quantSpectrum[n]) {
+      fprintf(stderr, "Huffman decoding mismatch at line %d\n", n);
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+
+/*
+ * Complete encode and decode frames
+ */
+
+typedef struct {
+  const char         *name;
+  AUDIO_OBJECT_TYPE   aot;
+  INT                 sampleRate;
+  INT                 bitrate;
+} BENCH_CODEC;
+
+static const BENCH_CODEC benchCodecs[] = {
+  { "AAC-LC",    AOT_AAC_LC,     44100, 128000 },
+  { "HE-AAC",    AOT_SBR,        44100,  64000 },
+  { "HE-AAC v2", AOT_PS,         44100,  32000 },
+  { "AAC-LD",    AOT_ER_AAC_LD,  48000, 128000 },
+  { "AAC-ELD",   AOT_ER_AAC_ELD, 48000,  96000 }
+};
+
+static INT benchCodec(const BENCH_CODEC *pCodec, const INT frames)
+{
+  HANDLE_AACENCODER hEncoder = NULL;
+  HANDLE_AACDECODER hDecoder = NULL;
+  AACENC_InfoStruct info;
+  INT_PCM *pInput = NULL, *pOutput = NULL;
+  UCHAR   *pAu = NULL;
+  INT     *pAuSize = NULL;
+  INT      frameLength, maxAuSize, nAus = 0, nDecoded = 0, decFrameSize = 0, decSampleRate = 0;
+  AAC_DECODER_ERROR decErr = AAC_DEC_OK;
+  UINT64   tEnc = 0, tDec = 0;
+  char     name[64];
+  INT      err = -1, i, n;
+
+  if ( (aacEncOpen(&hEncoder, 0, 2) != AACENC_OK)
+    || (aacEncoder_SetParam(hEncoder, AACENC_AOT, pCodec->aot) != AACENC_OK)
+    || (aacEncoder_SetParam(hEncoder, AACENC_SAMPLERATE, pCodec->sampleRate) != AACENC_OK)
+    || (aacEncoder_SetParam(hEncoder, AACENC_CHANNELMODE, MODE_2) != AACENC_OK)
+    || (aacEncoder_SetParam(hEncoder, AACENC_BITRATE, pCodec->bitrate) != AACENC_OK)
+    || (aacEncoder_SetParam(hEncoder, AACENC_TRANSMUX, TT_MP4_RAW) != AACENC_OK)
+    || (aacEncEncode(hEncoder, NULL, NULL, NULL, NULL) != AACENC_OK)
+    || (aacEncInfo(hEncoder, &info) != AACENC_OK) )
+  {
+    fprintf(stderr, "%s: encoder initialization failed\n", pCodec->name);
+    goto bail;
+  }
+  frameLength = info.frameLength;
+  maxAuSize   = info.maxOutBufBytes;
+
+  pInput  = (INT_PCM*)FDKcalloc(frames*frameLength*2, sizeof(INT_PCM));
+  pOutput = (INT_PCM*)FDKcalloc(8*2048, sizeof(INT_PCM));
+  pAu     = (UCHAR*)FDKcalloc(frames*maxAuSize, sizeof(UCHAR));
+  pAuSize = (INT*)FDKcalloc(frames, sizeof(INT));
+  if ( (pInput == NULL) || (pOutput == NULL) || (pAu == NULL) || (pAuSize == NULL) ) {
+    goto bail;
+  }
+
+  /* tones, a sweep and noise bursts */
+  for (n = 0; n < frames*frameLength; n++) {
+    for (i = 0; i < 2; i++) {
+      double x = 6000.0 * sin(0.013 * (i+1) * n)
+               + 2500.0 * sin(0.31 * n + i) * sin(0.0007 * n)
+               + 3000.0 * sin(3e-8 * (double)n * n)
+               + ((((n >> 11) & 3) == 1) ? benchRand() / 4 : benchRand() / 32);
+      pInput[2*n+i] = (INT_PCM)((INT)x << (SAMPLE_BITS-16));
+    }
+  }
+
+  for (n = 0; n < frames; n++) {
+    AACENC_BufDesc inBufDesc, outBufDesc;
+    AACENC_InArgs  inargs;
+    AACENC_OutArgs outargs;
+    void *pInBuf = pInput + n*frameLength*2, *pOutBuf = pAu + nAus*maxAuSize;
+    INT inId = IN_AUDIO_DATA, inSize = frameLength*2*sizeof(INT_PCM), inElSize = sizeof(INT_PCM);
+    INT outId = OUT_BITSTREAM_DATA, outSize = maxAuSize, outElSize = sizeof(UCHAR);
+    UINT64 t;
+
+    FDKmemclear(&inargs, sizeof(inargs));
+    FDKmemclear(&outargs, sizeof(outargs));
+    inargs.numInSamples = frameLength*2;
+
+    inBufDesc.numBufs = 1;
+    inBufDesc.bufs = &pInBuf;
+    inBufDesc.bufferIdentifiers = &inId;
+    inBufDesc.bufSizes = &inSize;
+    inBufDesc.bufElSizes = &inElSize;
+
+    outBufDesc.numBufs = 1;
+    outBufDesc.bufs = &pOutBuf;
+    outBufDesc.bufferIdentifiers = &outId;
+    outBufDesc.bufSizes = &outSize;
+    outBufDesc.bufElSizes = &outElSize;
+
+    t = FDKprofileNow();
+    if (aacEncEncode(hEncoder, &inBufDesc, &outBufDesc, &inargs, &outargs) != AACENC_OK) {
+      fprintf(stderr, "%s: encoding failed\n", pCodec->name);
+      goto bail;
+    }
+    tEnc += FDKprofileNow() - t;
+
+    if (outargs.numOutBytes > 0) {
+      pAuSize[nAus++] = outargs.numOutBytes;
+    }
+  }
+
+  hDecoder = aacDecoder_Open(TT_MP4_RAW, 1);
+  if (hDecoder == NULL) {
+    goto bail;
+  }
+  {
+    UCHAR *pConf = info.confBuf;
+    UINT   confSize = info.confSize;
+    if (aacDecoder_ConfigRaw(hDecoder, &pConf, &confSize) != AAC_DEC_OK) {
+      fprintf(stderr, "%s: decoder configuration failed\n", pCodec->name);
+      goto bail;
+    }
+  }
+
+  for (n = 0; n < nAus; n++) {
+    UCHAR *pBuf = pAu + n*maxAuSize;
+    UINT   size = pAuSize[n], valid = size;
+    AAC_DECODER_ERROR frameErr;
+    UINT64 t;
+
+    t = FDKprofileNow();
+    aacDecoder_Fill(hDecoder, &pBuf, &size, &valid);
+    frameErr = aacDecoder_DecodeFrame(hDecoder, pOutput, 8*2048, 0);
+    tDec += FDKprofileNow() - t;
+
+    if (frameErr == AAC_DEC_OK) {
+      nDecoded++;
+    } else {
+      decErr = frameErr;
+    }
+  }
+  if (nDecoded > 0) {
+    CStreamInfo *pStreamInfo = aacDecoder_GetStreamInfo(hDecoder);
+    decFrameSize  = pStreamInfo->frameSize;
+    decSampleRate = pStreamInfo->sampleRate;
+  }
+
+  sprintf(name, "encode %s", pCodec->name);
+  benchReport(name, tEnc, frames, frameLength, pCodec->sampleRate);
+  sprintf(name, "decode %s", pCodec->name);
+  if (nDecoded > 0) {
+    benchReport(name, tDec, nAus, decFrameSize, decSampleRate);
+  }
+  if (decErr != AAC_DEC_OK) {
+    printf("%-32s %d of %d frames failed, last error 0x%04x\n", name, nAus-nDecoded, nAus, decErr);
+  }
+  err = 0;
+
+bail:
+  if (hDecoder != NULL) {
+    aacDecoder_Close(hDecoder);
+  }
+  aacEncClose(&hEncoder);
+  if (pAuSize != NULL) FDKfree(pAuSize);
+  if (pAu != NULL)     FDKfree(pAu);
+  if (pOutput != NULL) FDKfree(pOutput);
+  if (pInput != NULL)  FDKfree(pInput);
+
+  return err;
+}
+
+/*
+ * Clips encoded after another stream against a new encoder
+ */
+
+typedef struct {
+  const char         *name;
+  AUDIO_OBJECT_TYPE   aot;
+  INT                 sbrRatio;
+  INT                 channels;
+  INT                 sampleRate;
+  INT                 bitrate;
+  TRANSPORT_TYPE      transport;
+} BENCH_CLIPS;
+
+static const BENCH_CLIPS benchClipConfigs[] = {
+  { "AAC-LD",                 AOT_ER_AAC_LD,  0, 2, 48000, 128000, TT_MP4_RAW },
+  { "AAC-LD LATM",            AOT_ER_AAC_LD,  0, 1, 32000,  48000, TT_MP4_LATM_MCP1 },
+  { "AAC-ELD",                AOT_ER_AAC_ELD, 0, 2, 48000,  96000, TT_MP4_RAW },
+  { "AAC-ELD LOAS",           AOT_ER_AAC_ELD, 0, 1, 44100,  64000, TT_MP4_LOAS },
+  { "AAC-ELD SBR",            AOT_ER_AAC_ELD, 1, 2, 48000,  64000, TT_MP4_RAW },
+  { "AAC-ELD SBR LATM",       AOT_ER_AAC_ELD, 1, 1, 32000,  32000, TT_MP4_LATM_MCP1 },
+  { "AAC-ELD dual-rate SBR",  AOT_ER_AAC_ELD, 2, 2, 48000,  96000, TT_MP4_RAW },
+  { "AAC-ELD dual-rate LOAS", AOT_ER_AAC_ELD, 2, 2, 44100,  96000, TT_MP4_LOAS }
+};
+
+static HANDLE_AACENCODER benchClipsOpen(const BENCH_CLIPS *pConfig)
+{
+  HANDLE_AACENCODER hEncoder = NULL;
+  AACENC_InfoStruct info;
+
+  if ( (aacEncOpen(&hEncoder, 0, pConfig->channels) != AACENC_OK)
+    || (aacEncoder_SetParam(hEncoder, AACENC_AOT, pConfig->aot) != AACENC_OK)
+    || ((pConfig->sbrRatio != 0) && (aacEncoder_SetParam(hEncoder, AACENC_SBR_MODE, 1) != AACENC_OK))
+    || ((pConfig->sbrRatio != 0) && (aacEncoder_SetParam(hEncoder, AACENC_SBR_RATIO, pConfig->sbrRatio) != AACENC_OK))
+    || (aacEncoder_SetParam(hEncoder, AACENC_SAMPLERATE, pConfig->sampleRate) != AACENC_OK)
+    || (aacEncoder_SetParam(hEncoder, AACENC_CHANNELMODE, (pConfig->channels==2) ? MODE_2 : MODE_1) != AACENC_OK)
+    || (aacEncoder_SetParam(hEncoder, AACENC_BITRATE, pConfig->bitrate) != AACENC_OK)
+    || (aacEncoder_SetParam(hEncoder, AACENC_TRANSMUX, pConfig->transport) != AACENC_OK)
+    || (aacEncEncode(hEncoder, NULL, NULL, NULL, NULL) != AACENC_OK)
+    || (aacEncInfo(hEncoder, &info) != AACENC_OK) )
+  {
+    aacEncClose(&hEncoder);
+  }
+
+  return hEncoder;
+}
+
+/* Each clip of a reused encoder has to match the clip of a newly opened one. */
+static INT benchClips(const BENCH_CLIPS *pConfig)
+{
+  enum { CLIPS = 4, CLIP_LEN = 24000, CLIP_BUF = 64*1024 };
+  HANDLE_AACENCODER hEncoder = NULL, hNewEncoder = NULL;
+  AACENC_CLIP clip[CLIPS], newClip;
+  INT_PCM *pInput = NULL;
+  UCHAR   *pOut = NULL, *pNewOut = NULL;
+  const INT nCh = pConfig->channels;
+  INT      err = -1, i, n;
+
+  pInput  = (INT_PCM*)FDKcalloc(CLIPS*CLIP_LEN*nCh, sizeof(INT_PCM));
+  pOut    = (UCHAR*)FDKcalloc(CLIPS*CLIP_BUF, sizeof(UCHAR));
+  pNewOut = (UCHAR*)FDKcalloc(CLIP_BUF, sizeof(UCHAR));
+  if ( (pInput == NULL) || (pOut == NULL) || (pNewOut == NULL) ) {
+    goto bail;
+  }
+
+  for (n = 0; n < CLIPS*CLIP_LEN; n++) {
+    for (i = 0; i < nCh; i++) {
+      double x = 6000.0 * sin(0.013 * (i+1) * n + n / CLIP_LEN)
+               + ((((n >> 12) & 1) == 1) ? benchRand() / 4 : benchRand() / 32);
+      pInput[nCh*n+i] = (INT_PCM)((INT)x << (SAMPLE_BITS-16));
+    }
+  }
+
+  /* clips of different lengths, the first one leaves its history in the encoder */
+  for (i = 0; i < CLIPS; i++) {
+    clip[i].pInput       = pInput + i*CLIP_LEN*nCh;
+    clip[i].numInSamples = (CLIP_LEN - (i*997)%(CLIP_LEN/2)) * nCh;
+    clip[i].pOutBuf      = pOut + i*CLIP_BUF;
+    clip[i].outBufSize   = CLIP_BUF;
+    clip[i].pAuSizes     = NULL;
+    clip[i].maxAus       = 0;
+  }
+
+  if ( ((hEncoder = benchClipsOpen(pConfig)) == NULL)
+    || (aacEncEncodeClips(hEncoder, clip, CLIPS) != AACENC_OK) )
+  {
+    fprintf(stderr, "%s: clip encoding failed\n", pConfig->name);
+    goto bail;
+  }
+
+  for (i = 0; i < CLIPS; i++) {
+    newClip = clip[i];
+    newClip.pOutBuf = pNewOut;
+
+    if ( ((hNewEncoder = benchClipsOpen(pConfig)) == NULL)
+      || (aacEncEncodeClips(hNewEncoder, &newClip, 1) != AACENC_OK) )
+    {
+      fprintf(stderr, "%s: clip encoding failed\n", pConfig->name);
+      goto bail;
+    }
+    aacEncClose(&hNewEncoder);
+
+    if ( (newClip.numOutBytes != clip[i].numOutBytes)
+      || (FDKmemcmp(newClip.pOutBuf, clip[i].pOutBuf, newClip.numOutBytes) != 0) )
+    {
+      fprintf(stderr, "%s: clip %d differs from a new encoder\n", pConfig->name, i);
+      goto bail;
+    }
+  }
+  printf("%-32s %d clips match\n", pConfig->name, CLIPS);
+  err = 0;
+
+bail:
+  aacEncClose(&hNewEncoder);
+  aacEncClose(&hEncoder);
+  if (pNewOut != NULL) FDKfree(pNewOut);
+  if (pOut != NULL)    FDKfree(pOut);
+  if (pInput != NULL)  FDKfree(pInput);
+
+  return err;
+}
+
+
+int main(int argc, char *argv[])
+{
+  INT iterations = 1000;
+  INT err = 0;
+  UINT i;
+
+  if (argc > 2) {
+    fprintf(stderr, "%s [iterations]\n", argv[0]);
+    return 1;
+  }
+  if (argc > 1) {
+    iterations = fixMax(1, atoi(argv[1]));
+  }
+
+  printf("iterations %d, cpu features 0x%x\n\n", iterations, FDK_getCpuFeatures());
+
+  benchSeed = 1;
+  benchFft(10*iterations);
+  benchDct(iterations);
+  benchImdct(iterations);
+  benchQmf(iterations);
+  if (benchSpectrum(iterations) != 0) {
+    err = 1;
+  }
+
+  printf("\n");
+  for (i = 0; i < sizeof(benchCodecs)/sizeof(benchCodecs[0]); i++) {
+    if (benchCodec(&benchCodecs[i], fixMax(10, iterations/4)) != 0) {
+      err = 1;
+    }
+  }
+
+  printf("\n");
+  for (i = 0; i < sizeof(benchClipConfigs)/sizeof(benchClipConfigs[0]); i++) {
+    if (benchClips(&benchClipConfigs[i]) != 0) {
+      err = 1;
+    }
+  }
+
+  return err;
+}
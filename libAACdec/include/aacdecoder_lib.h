@@ -450,6 +450,17 @@ typedef enum
                                                           Default confguration is 15 ms. Adjustable range from 1 ms to 15 ms. */
   AAC_PCM_LIMITER_RELEAS_TIME             = 0x0006,  /*!< Signal level limiting release time in ms.
                                                           Default configuration is 50 ms. Adjustable time must be larger than 0 ms. */
+  AAC_PCM_OUTPUT_IN_PLACE                 = 0x0007,  /*!< Decode directly into the time data buffer handed to aacDecoder_DecodeFrame(). \n
+                                                          0: Decode into an internal buffer and copy the result (default). \n
+                                                          1: Core decoding, SBR, PCM downmix and limiter operate in place in the client buffer
+                                                             which saves copying (and clearing) one output frame per call. The client buffer serves
+                                                             as work buffer and must hold at least
+                                                             max(channels, 2) * max(2 * CStreamInfo::aacSamplesPerFrame, 2048 if
+                                                             CStreamInfo::aacSamplesPerFrame is 768) samples, where channels is the number of
+                                                             channels of the channel configuration (8 for CStreamInfo::channelConfig 0) or
+                                                             ::AAC_PCM_MIN_OUTPUT_CHANNELS if higher. Smaller buffers are served through the
+                                                             internal buffer as in mode 0. Samples beyond
+                                                             CStreamInfo::numChannels * CStreamInfo::frameSize are undefined after the call. */
   AAC_PCM_MIN_OUTPUT_CHANNELS             = 0x0011,  /*!< Minimum number of PCM output channels. If higher than the number of encoded audio channels,
                                                           a simple channel extension is applied. \n
                                                           -1, 0: Disable channel extenstion feature. The decoder output contains the same number of
@@ -525,9 +536,18 @@ typedef enum
   AAC_MPEGS_ENABLE                        = 0x0500,  /*!< MPEG Surround: Allow/Disable decoding of MPS content. Available only for decoders with MPEG
                                                           Surround support. */
 
-  AAC_TPDEC_CLEAR_BUFFER                  = 0x0603   /*!< Clear internal bit stream buffer of transport layers. The decoder will start decoding
+  AAC_TPDEC_CLEAR_BUFFER                  = 0x0603,  /*!< Clear internal bit stream buffer of transport layers. The decoder will start decoding
                                                           at new data passed after this event and any previous data is discarded. */
 
+  AAC_NUM_THREADS                         = 0x0700   /*!< Number of threads used to process the channels of one frame in parallel. Bit stream
+                                                          parsing, concealment and DRC remain sequential. The inverse transforms of all channels
+                                                          and the SBR elements run on a worker pool. The decoded output is identical to
+                                                          single-threaded operation. The worker pool and the scratch memory of each
+                                                          thread are allocated like the other instance memory, i.e. from the arena of
+                                                          aacDecoder_OpenArena() if any. \n
+                                                          0, 1: Single-threaded (default). \n
+                                                          2 ... 8: Number of threads including the calling thread. */
+
 } AACDEC_PARAM;
 
 /**
@@ -660,6 +680,81 @@ aacDecoder_GetFreeBytes ( const HANDLE_AACDECODER  self,
 LINKSPEC_H HANDLE_AACDECODER
 aacDecoder_Open ( TRANSPORT_TYPE transportFmt, UINT nrOfLayers );
 
+/**
+ * \brief               Get the size of a memory block sufficient for aacDecoder_OpenArena().
+ *                      The size covers the decoder instance itself and, if a configuration is given, all
+ *                      memory allocated for this configuration including implicitly signaled SBR and PS.
+ *                      Configurations with more channels signaled later in-band may require a larger block.
+ * \param transportFmt  The transport type to be used.
+ * \param nrOfLayers    Number of transport layers.
+ * \param conf          Binary configuration buffers per layer as for aacDecoder_ConfigRaw(), or NULL.
+ * \param length        Length of the configuration buffers in bytes, or NULL.
+ * \return              Memory block size in bytes, 0 if the decoder could not be opened or configured.
+ */
+LINKSPEC_H UINT
+aacDecoder_GetArenaSize ( TRANSPORT_TYPE transportFmt, UINT nrOfLayers, UCHAR *conf[], const UINT length[] );
+
+/**
+ * \brief               Open an AAC decoder instance within an application provided memory block.
+ *                      All memory of the instance is taken from this block, no heap memory is allocated.
+ *                      The block must remain valid until aacDecoder_Close() returned. If the block is too
+ *                      small for a configuration, the remaining memory is taken from the heap.
+ * \param transportFmt  The transport type to be used.
+ * \param nrOfLayers    Number of transport layers.
+ * \param pArena        Memory block, see aacDecoder_GetArenaSize().
+ * \param arenaSize     Size of the memory block in bytes.
+ * \return              AAC decoder handle
+ */
+LINKSPEC_H HANDLE_AACDECODER
+aacDecoder_OpenArena ( TRANSPORT_TYPE transportFmt, UINT nrOfLayers, void *pArena, const UINT arenaSize );
+
+/**
+ * \brief               Get the memory requirements of an AAC decoder instance per memory section.
+ *                      A decoder instance is opened, configured and closed again to determine the amount of
+ *                      memory that aacDecoder_Open() and aacDecoder_ConfigRaw() allocate, including implicitly
+ *                      signaled SBR and PS. Persistent memory is needed by each instance. Scratch memory holds the
+ *                      work buffers, which are needed once per thread if aacDecoder_ShareWorkBuffers() is enabled.
+ *                      Configurations with more channels signaled later in-band may require more memory.
+ * \param transportFmt  The transport type to be used.
+ * \param nrOfLayers    Number of transport layers.
+ * \param conf          Binary configuration buffers per layer as for aacDecoder_ConfigRaw(), or NULL.
+ * \param length        Length of the configuration buffers in bytes, or NULL.
+ * \param pMemInfo      Pointer to a structure receiving the byte counts.
+ * \return              Error code.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_GetMemRequirements ( TRANSPORT_TYPE transportFmt, UINT nrOfLayers, UCHAR *conf[], const UINT length[],
+                                FDK_MEM_INFO *pMemInfo );
+
+/**
+ * \brief               Get the processing time statistics of an AAC decoder instance. Reports the time spent in
+ *                      Huffman decoding of the spectral data, frequency to time conversion, SBR QMF filtering,
+ *                      parametric stereo, DRC and the limiter, accumulated over all aacDecoder_DecodeFrame() calls
+ *                      since the instance was opened, in nanoseconds together with the number of calls per stage.
+ *                      The statistics are only collected if the library is configured with --enable-profiling,
+ *                      i.e. built with FDK_PROFILE defined.
+ * \param self          AAC decoder handle.
+ * \param pStats        Pointer to a structure receiving the statistics, cleared if not available.
+ * \return              AAC_DEC_OK on success, AAC_DEC_SET_PARAM_FAIL if the library is built without profiling.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_GetStats ( HANDLE_AACDECODER self, FDK_PROF_STATS *pStats );
+
+/**
+ * \brief          Enable or disable sharing of work buffers between AAC decoder instances of the calling thread.
+ *                 The work buffers only hold data used within one aacDecoder_DecodeFrame() call. If sharing is
+ *                 enabled, all instances subsequently opened by the calling thread use one reference-counted set of
+ *                 work buffers, which is freed when the last of these instances is closed. This reduces the memory
+ *                 footprint of applications decoding many streams. Instances sharing work buffers must be opened,
+ *                 used and closed by the same thread, and must not be decoded concurrently. Shared work buffers are always taken from the
+ *                 heap, also for instances opened with aacDecoder_OpenArena(). Sharing is disabled by default; the
+ *                 setting does not affect instances that are already open.
+ * \param enable   0: each instance allocates its own work buffers, 1: instances share work buffers.
+ * \return         Previous setting.
+ */
+LINKSPEC_H INT
+aacDecoder_ShareWorkBuffers ( const UINT enable );
+
 /**
  * \brief Explicitly configure the decoder by passing a raw AudioSpecificConfig (ASC) or a StreamMuxConfig (SMC),
  *  contained in a binary buffer. This is required for MPEG-4 and Raw Packets file format bitstreams
@@ -717,6 +812,8 @@ aacDecoder_Fill ( HANDLE_AACDECODER  self,
  *
  * \param self       AAC decoder handle.
  * \param pTimeData  Pointer to external output buffer where the decoded PCM samples will be stored into.
+ *                   The sample width is given by INT_PCM, i.e. 32 bit if the library is configured with
+ *                   --with-pcm-bits=32, 16 bit otherwise.
  * \param flags      Bit field with flags for the decoder: \n
  *                   (flags & AACDEC_CONCEAL) == 1: Do concealment. \n
  *                   (flags & AACDEC_FLUSH) == 2: Discard input data. Flush filter banks (output delayed audio). \n
@@ -729,6 +826,39 @@ aacDecoder_DecodeFrame ( HANDLE_AACDECODER  self,
                          const INT          timeDataSize,
                          const UINT         flags );
 
+/**
+ *  Describes one decoder instance of an aacDecoder_DecodeFrameBatch() call.
+ */
+typedef struct {
+  HANDLE_AACDECODER  hDecoder;      /*!< AAC decoder handle. */
+  INT_PCM           *pTimeData;     /*!< Output buffer, see aacDecoder_DecodeFrame(). */
+  INT                timeDataSize;  /*!< Size of pTimeData in samples. */
+
+  AAC_DECODER_ERROR  err;           /*!< Returns the result of this instance, as aacDecoder_DecodeFrame() would. */
+} AACDEC_BATCH_ITEM;
+
+/**
+ * \brief            Decode one audio frame for each of a list of decoder instances.
+ *
+ *                   The result of each instance is identical to calling aacDecoder_DecodeFrame() on it. Instead of
+ *                   decoding one instance after the other, groups of up to 16 instances are moved through the
+ *                   decoding stages together: first transport, spectral decoding and frequency to time conversion
+ *                   of all instances of the group, then SBR and PCM post processing of all of them. Within a group
+ *                   instances with equal configuration are processed next to each other. This keeps tables and code
+ *                   of one stage in the caches when many streams are decoded on one thread. Input data has to be
+ *                   provided with aacDecoder_Fill() for every instance beforehand.
+ *
+ * \param pItems     Decoder instances and their output buffers. Every instance may appear only once.
+ * \param numItems   Number of entries of pItems.
+ * \param flags      Flags applied to all instances, see aacDecoder_DecodeFrame().
+ * \return           AAC_DEC_OK if all instances returned AAC_DEC_OK, otherwise the first error in list order, see
+ *                   AACDEC_BATCH_ITEM::err.
+ */
+LINKSPEC_H AAC_DECODER_ERROR
+aacDecoder_DecodeFrameBatch ( AACDEC_BATCH_ITEM *pItems,
+                              const UINT         numItems,
+                              const UINT         flags );
+
 /**
  * \brief       De-allocate all resources of an AAC decoder instance.
  *
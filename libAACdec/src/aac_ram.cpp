@@ -133,6 +133,12 @@ C_ALLOC_MEM_OVERLAY(WorkBufferCore2, FIXP_DBL, ((8)*1024), SECT_DATA_L2, WORKBUF
 
 C_ALLOC_MEM_OVERLAY(WorkBufferCore1, CWorkBufferCore1, 1, SECT_DATA_L1, WORKBUFFER1_TAG)
 
+/*
+   Workers of the channel-parallel inverse transform need private scratch memory, because
+   mdctOutTemp located in WorkBufferCore1 is shared by all channels.
+*/
+C_ALLOC_MEM2_SCRATCH(MdctOutTempWorker, FIXP_DBL, 1024, FDK_MAX_WORKERS)
+
 /* @{ */
 
 
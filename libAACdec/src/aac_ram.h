@@ -115,6 +115,7 @@ H_ALLOC_MEM(OverlapBuffer, FIXP_DBL)
 
 H_ALLOC_MEM_OVERLAY(WorkBufferCore1, CWorkBufferCore1)
 H_ALLOC_MEM_OVERLAY(WorkBufferCore2, FIXP_DBL)
+H_ALLOC_MEM(MdctOutTempWorker, FIXP_DBL)
 
 
 #endif /* #ifndef AAC_RAM_H */
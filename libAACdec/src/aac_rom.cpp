@@ -715,24 +715,571 @@ const USHORT HuffmanCodeBook_SCL[65][4] =
 
 
 
-/* .CodeBook = HuffmanCodeBook_x, .Dimension = 4, .numBits = 2, .Offset =  0  */
+/*
+  Spectral Huffman lookup tables, derived from HuffmanCodeBook_1..11 above.
+  Layout see aac_rom.h, root tables are indexed with HuffmanLookupBits = 8 bits.
+*/
+const UINT HuffmanLookup_1[304] =
+{
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001,
+  0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f,
+  0x05fc0000, 0x05fc0000, 0x05fc0000, 0x05fc0000, 0x05fc0000, 0x05fc0000, 0x05fc0000, 0x05fc0000,
+  0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040,
+  0x05040000, 0x05040000, 0x05040000, 0x05040000, 0x05040000, 0x05040000, 0x05040000, 0x05040000,
+  0x0503f000, 0x0503f000, 0x0503f000, 0x0503f000, 0x0503f000, 0x0503f000, 0x0503f000, 0x0503f000,
+  0x05001000, 0x05001000, 0x05001000, 0x05001000, 0x05001000, 0x05001000, 0x05001000, 0x05001000,
+  0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0,
+  0x07000fc1, 0x07000fc1, 0x0700007f, 0x0700007f, 0x0707f000, 0x0707f000, 0x0703f040, 0x0703f040,
+  0x07001fc0, 0x07001fc0, 0x07fc1000, 0x07fc1000, 0x07000041, 0x07000041, 0x07fff000, 0x07fff000,
+  0x07000fff, 0x07000fff, 0x0703ffc0, 0x0703ffc0, 0x0703f001, 0x0703f001, 0x07fc0040, 0x07fc0040,
+  0x0700103f, 0x0700103f, 0x07041000, 0x07041000, 0x07001001, 0x07001001, 0x07040fc0, 0x07040fc0,
+  0x07001040, 0x07001040, 0x07040040, 0x07040040, 0x0703f03f, 0x0703f03f, 0x07040001, 0x07040001,
+  0x07fc003f, 0x07fc003f, 0x07fc0001, 0x07fc0001, 0x0704003f, 0x0704003f, 0x07fc0fc0, 0x07fc0fc0,
+  0x80010100, 0x80010102, 0x80010104, 0x80010106, 0x80010108, 0x8001010a, 0x8001010c, 0x8001010e,
+  0x80010110, 0x80010112, 0x80010114, 0x80010116, 0x80020118, 0x8002011c, 0x80030120, 0x80030128,
+  0x0103f041, 0x0103f07f, 0x01001fc1, 0x01fc1040, 0x0107f040, 0x01041fc0, 0x01fc1fc0, 0x0103ffc1,
+  0x0107f001, 0x01fff040, 0x0100107f, 0x01fc103f, 0x01001fff, 0x0107ffc0, 0x01040fc1, 0x01fc0fc1,
+  0x01fc007f, 0x0103ffff, 0x01ffffc0, 0x01041040, 0x01fc1001, 0x01040041, 0x0104007f, 0x01001041,
+  0x02040fff, 0x02fff03f, 0x02fc0041, 0x02fff001, 0x0207f03f, 0x02fc0fff, 0x0204103f, 0x02041001,
+  0x03fc1fc1, 0x0307f07f, 0x03fc107f, 0x0307ffc1, 0x03041041, 0x03041fff, 0x03fff041, 0x03fc1fff,
+  0x03ffffff, 0x0307f041, 0x03041fc1, 0x0304107f, 0x03fff07f, 0x0307ffff, 0x03ffffc1, 0x03fc1041
+};
+
+const UINT HuffmanLookup_2[270] =
+{
+  0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000,
+  0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000,
+  0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000,
+  0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000, 0x03000000,
+  0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001,
+  0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001,
+  0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f,
+  0x05040000, 0x05040000, 0x05040000, 0x05040000, 0x05040000, 0x05040000, 0x05040000, 0x05040000,
+  0x0503f000, 0x0503f000, 0x0503f000, 0x0503f000, 0x0503f000, 0x0503f000, 0x0503f000, 0x0503f000,
+  0x05fc0000, 0x05fc0000, 0x05fc0000, 0x05fc0000, 0x05fc0000, 0x05fc0000, 0x05fc0000, 0x05fc0000,
+  0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0,
+  0x05001000, 0x05001000, 0x05001000, 0x05001000, 0x05001000, 0x05001000, 0x05001000, 0x05001000,
+  0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040,
+  0x06001fc0, 0x06001fc0, 0x06001fc0, 0x06001fc0, 0x0600007f, 0x0600007f, 0x0600007f, 0x0600007f,
+  0x0603f040, 0x0603f040, 0x0603f040, 0x0603f040, 0x06fc1000, 0x06fc1000, 0x06fc1000, 0x06fc1000,
+  0x06fc0040, 0x06fc0040, 0x06fc0040, 0x06fc0040, 0x0607f000, 0x0607f000, 0x0607f000, 0x0607f000,
+  0x06fc003f, 0x06fc003f, 0x06fc003f, 0x06fc003f, 0x06000fc1, 0x06000fc1, 0x06000fc1, 0x06000fc1,
+  0x0603f001, 0x0603f001, 0x0603f001, 0x0603f001, 0x06000fff, 0x06000fff, 0x06000fff, 0x06000fff,
+  0x06fff000, 0x06fff000, 0x06fff000, 0x06fff000, 0x06001001, 0x06001001, 0x06001001, 0x06001001,
+  0x06040001, 0x06040001, 0x06040001, 0x06040001, 0x06040fc0, 0x06040fc0, 0x06040fc0, 0x06040fc0,
+  0x0600103f, 0x0600103f, 0x0600103f, 0x0600103f, 0x06040040, 0x06040040, 0x06040040, 0x06040040,
+  0x0603ffc0, 0x0603ffc0, 0x0603ffc0, 0x0603ffc0, 0x0604003f, 0x0604003f, 0x0604003f, 0x0604003f,
+  0x06fc0fc0, 0x06fc0fc0, 0x06fc0fc0, 0x06fc0fc0, 0x0603f03f, 0x0603f03f, 0x0603f03f, 0x0603f03f,
+  0x06000041, 0x06000041, 0x06000041, 0x06000041, 0x06001040, 0x06001040, 0x06001040, 0x06001040,
+  0x06041000, 0x06041000, 0x06041000, 0x06041000, 0x06fc0001, 0x06fc0001, 0x06fc0001, 0x06fc0001,
+  0x0707f040, 0x0707f040, 0x0707f001, 0x0707f001, 0x0703f07f, 0x0703f07f, 0x07fc1fc0, 0x07fc1fc0,
+  0x07001fc1, 0x07001fc1, 0x07fc0041, 0x07fc0041, 0x07041001, 0x07041001, 0x0700107f, 0x0700107f,
+  0x0707ffc0, 0x0707ffc0, 0x07001041, 0x07001041, 0x07fc103f, 0x07fc103f, 0x0703ffff, 0x0703ffff,
+  0x0707f03f, 0x0707f03f, 0x0703ffc1, 0x0703ffc1, 0x0703f041, 0x0703f041, 0x08040fc1, 0x08fc007f,
+  0x08001fff, 0x0804103f, 0x08040fff, 0x08fc0fff, 0x08ffffc0, 0x08fc1001, 0x08fff001, 0x08fff040,
+  0x08041040, 0x0804007f, 0x08fff03f, 0x08fc1040, 0x08fc0fc1, 0x08041fc0, 0x08040041, 0x08fc1fc1,
+  0x0807f07f, 0x80010100, 0x80010102, 0x80010104, 0x80010106, 0x80010108, 0x8001010a, 0x8001010c,
+  0x0107ffc1, 0x01ffffff, 0x01fc107f, 0x0104107f, 0x01041041, 0x01fc1fff, 0x01041fc1, 0x01fff07f,
+  0x01041fff, 0x01fff041, 0x01ffffc1, 0x0107ffff, 0x0107f041, 0x01fc1041
+};
+
+const UINT HuffmanLookup_3[550] =
+{
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001,
+  0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f,
+  0x05040000, 0x05040000, 0x05040000, 0x05040000, 0x05040000, 0x05040000, 0x05040000, 0x05040000,
+  0x05fc0000, 0x05fc0000, 0x05fc0000, 0x05fc0000, 0x05fc0000, 0x05fc0000, 0x05fc0000, 0x05fc0000,
+  0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040,
+  0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0,
+  0x05001000, 0x05001000, 0x05001000, 0x05001000, 0x05001000, 0x05001000, 0x05001000, 0x05001000,
+  0x0503f000, 0x0503f000, 0x0503f000, 0x0503f000, 0x0503f000, 0x0503f000, 0x0503f000, 0x0503f000,
+  0x07000041, 0x07000041, 0x07000fc1, 0x07000fc1, 0x0700007f, 0x0700007f, 0x07000fff, 0x07000fff,
+  0x07041000, 0x07041000, 0x07fc1000, 0x07fc1000, 0x0707f000, 0x0707f000, 0x07fff000, 0x07fff000,
+  0x08001040, 0x0803f040, 0x08001fc0, 0x0803ffc0, 0x08040040, 0x08fc0040, 0x08040fc0, 0x08fc0fc0,
+  0x08001001, 0x0803f001, 0x0800103f, 0x0803f03f, 0x26041040, 0x26041040, 0x26041040, 0x26041040,
+  0x08040001, 0x08fc0001, 0x0804003f, 0x08fc003f, 0x26001041, 0x26001041, 0x26001041, 0x26001041,
+  0x27041041, 0x27041041, 0x27041001, 0x27041001, 0x27040041, 0x27040041, 0x28000002, 0x28080000,
+  0x28081000, 0x28000042, 0x28001081, 0x80010100, 0x80010102, 0x80010104, 0x80010106, 0x80010108,
+  0x8001010a, 0x8001010c, 0x8002010e, 0x80020112, 0x80020116, 0x8002011a, 0x8003011e, 0x80080126,
+  0x21042000, 0x21042040, 0x21000081, 0x21081040, 0x21001042, 0x21002000, 0x21001080, 0x21002040,
+  0x21000080, 0x21080040, 0x21001002, 0x21041081, 0x21041080, 0x21002041, 0x21042041, 0x21042041,
+  0x22040081, 0x22002001, 0x22042001, 0x22040080, 0x22041042, 0x22081041, 0x22040042, 0x22081001,
+  0x22082000, 0x22082040, 0x22001082, 0x22002081, 0x22080001, 0x22040002, 0x22042080, 0x22042080,
+  0x23000082, 0x23042081, 0x23080041, 0x23041002, 0x23082041, 0x23041082, 0x05002080, 0x05002080,
+  0x05002080, 0x05002080, 0x05002080, 0x05002080, 0x05002080, 0x05002080, 0x0503e080, 0x0503e080,
+  0x0503e080, 0x0503e080, 0x0503e080, 0x0503e080, 0x0503e080, 0x0503e080, 0x05002f80, 0x05002f80,
+  0x05002f80, 0x05002f80, 0x05002f80, 0x05002f80, 0x05002f80, 0x05002f80, 0x0503ef80, 0x0503ef80,
+  0x0503ef80, 0x0503ef80, 0x0503ef80, 0x0503ef80, 0x0503ef80, 0x0503ef80, 0x06081080, 0x06081080,
+  0x06081080, 0x06081080, 0x06f81080, 0x06f81080, 0x06f81080, 0x06f81080, 0x060bf080, 0x060bf080,
+  0x060bf080, 0x060bf080, 0x06fbf080, 0x06fbf080, 0x06fbf080, 0x06fbf080, 0x06081f80, 0x06081f80,
+  0x06081f80, 0x06081f80, 0x06f81f80, 0x06f81f80, 0x06f81f80, 0x06f81f80, 0x060bff80, 0x060bff80,
+  0x060bff80, 0x060bff80, 0x06fbff80, 0x06fbff80, 0x06fbff80, 0x06fbff80, 0x07082001, 0x07082001,
+  0x07f82001, 0x07f82001, 0x070be001, 0x070be001, 0x07fbe001, 0x07fbe001, 0x0708203f, 0x0708203f,
+  0x07f8203f, 0x07f8203f, 0x070be03f, 0x070be03f, 0x07fbe03f, 0x07fbe03f, 0x07040082, 0x07040082,
+  0x07fc0082, 0x07fc0082, 0x07040f82, 0x07040f82, 0x07fc0f82, 0x07fc0f82, 0x070400be, 0x070400be,
+  0x07fc00be, 0x07fc00be, 0x07040fbe, 0x07040fbe, 0x07fc0fbe, 0x07fc0fbe, 0x07002042, 0x07002042,
+  0x0703e042, 0x0703e042, 0x07002fc2, 0x07002fc2, 0x0703efc2, 0x0703efc2, 0x0700207e, 0x0700207e,
+  0x0703e07e, 0x0703e07e, 0x07002ffe, 0x07002ffe, 0x0703effe, 0x0703effe, 0x07002082, 0x07002082,
+  0x0703e082, 0x0703e082, 0x07002f82, 0x07002f82, 0x0703ef82, 0x0703ef82, 0x070020be, 0x070020be,
+  0x0703e0be, 0x0703e0be, 0x07002fbe, 0x07002fbe, 0x0703efbe, 0x0703efbe, 0x07082080, 0x07082080,
+  0x07f82080, 0x07f82080, 0x070be080, 0x070be080, 0x07fbe080, 0x07fbe080, 0x07082f80, 0x07082f80,
+  0x07f82f80, 0x07f82f80, 0x070bef80, 0x070bef80, 0x07fbef80, 0x07fbef80, 0x08042082, 0x08fc2082,
+  0x0807e082, 0x08ffe082, 0x08042f82, 0x08fc2f82, 0x0807ef82, 0x08ffef82, 0x080420be, 0x08fc20be,
+  0x0807e0be, 0x08ffe0be, 0x08042fbe, 0x08fc2fbe, 0x0807efbe, 0x08ffefbe, 0x08042042, 0x08fc2042,
+  0x0807e042, 0x08ffe042, 0x08042fc2, 0x08fc2fc2, 0x0807efc2, 0x08ffefc2, 0x0804207e, 0x08fc207e,
+  0x0807e07e, 0x08ffe07e, 0x08042ffe, 0x08fc2ffe, 0x0807effe, 0x08ffeffe, 0x08081081, 0x08f81081,
+  0x080bf081, 0x08fbf081, 0x08081f81, 0x08f81f81, 0x080bff81, 0x08fbff81, 0x080810bf, 0x08f810bf,
+  0x080bf0bf, 0x08fbf0bf, 0x08081fbf, 0x08f81fbf, 0x080bffbf, 0x08fbffbf, 0x08082081, 0x08f82081,
+  0x080be081, 0x08fbe081, 0x08082f81, 0x08f82f81, 0x080bef81, 0x08fbef81, 0x080820bf, 0x08f820bf,
+  0x080be0bf, 0x08fbe0bf, 0x08082fbf, 0x08f82fbf, 0x080befbf, 0x08fbefbf, 0x07080080, 0x07080080,
+  0x07f80080, 0x07f80080, 0x07080f80, 0x07080f80, 0x07f80f80, 0x07f80f80, 0x07002002, 0x07002002,
+  0x0703e002, 0x0703e002, 0x0700203e, 0x0700203e, 0x0703e03e, 0x0703e03e, 0x08080081, 0x08f80081,
+  0x08080f81, 0x08f80f81, 0x080800bf, 0x08f800bf, 0x08080fbf, 0x08f80fbf, 0x26042002, 0x26042002,
+  0x26042002, 0x26042002, 0x26081042, 0x26081042, 0x26081042, 0x26081042, 0x26080042, 0x26080042,
+  0x26080042, 0x26080042, 0x27082082, 0x27082082, 0x27081082, 0x27081082, 0x27082042, 0x27082042,
+  0x27081002, 0x27081002, 0x27080002, 0x27080002, 0x28080082, 0x28082002
+};
+
+const UINT HuffmanLookup_4[300] =
+{
+  0x08041041, 0x08fc1041, 0x0807f041, 0x08fff041, 0x08041fc1, 0x08fc1fc1, 0x0807ffc1, 0x08ffffc1,
+  0x0804107f, 0x08fc107f, 0x0807f07f, 0x08fff07f, 0x08041fff, 0x08fc1fff, 0x0807ffff, 0x08ffffff,
+  0x07041040, 0x07041040, 0x07fc1040, 0x07fc1040, 0x0707f040, 0x0707f040, 0x07fff040, 0x07fff040,
+  0x07041fc0, 0x07041fc0, 0x07fc1fc0, 0x07fc1fc0, 0x0707ffc0, 0x0707ffc0, 0x07ffffc0, 0x07ffffc0,
+  0x07040041, 0x07040041, 0x07fc0041, 0x07fc0041, 0x07040fc1, 0x07040fc1, 0x07fc0fc1, 0x07fc0fc1,
+  0x0704007f, 0x0704007f, 0x07fc007f, 0x07fc007f, 0x07040fff, 0x07040fff, 0x07fc0fff, 0x07fc0fff,
+  0x07001041, 0x07001041, 0x0703f041, 0x0703f041, 0x07001fc1, 0x07001fc1, 0x0703ffc1, 0x0703ffc1,
+  0x0700107f, 0x0700107f, 0x0703f07f, 0x0703f07f, 0x07001fff, 0x07001fff, 0x0703ffff, 0x0703ffff,
+  0x07041001, 0x07041001, 0x07fc1001, 0x07fc1001, 0x0707f001, 0x0707f001, 0x07fff001, 0x07fff001,
+  0x0704103f, 0x0704103f, 0x07fc103f, 0x07fc103f, 0x0707f03f, 0x0707f03f, 0x07fff03f, 0x07fff03f,
+  0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001,
+  0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f,
+  0x06000041, 0x06000041, 0x06000041, 0x06000041, 0x06000fc1, 0x06000fc1, 0x06000fc1, 0x06000fc1,
+  0x0600007f, 0x0600007f, 0x0600007f, 0x0600007f, 0x06000fff, 0x06000fff, 0x06000fff, 0x06000fff,
+  0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000,
+  0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000,
+  0x06041000, 0x06041000, 0x06041000, 0x06041000, 0x06fc1000, 0x06fc1000, 0x06fc1000, 0x06fc1000,
+  0x0607f000, 0x0607f000, 0x0607f000, 0x0607f000, 0x06fff000, 0x06fff000, 0x06fff000, 0x06fff000,
+  0x06001001, 0x06001001, 0x06001001, 0x06001001, 0x0603f001, 0x0603f001, 0x0603f001, 0x0603f001,
+  0x0600103f, 0x0600103f, 0x0600103f, 0x0600103f, 0x0603f03f, 0x0603f03f, 0x0603f03f, 0x0603f03f,
+  0x07040001, 0x07040001, 0x07fc0001, 0x07fc0001, 0x0704003f, 0x0704003f, 0x07fc003f, 0x07fc003f,
+  0x07001040, 0x07001040, 0x0703f040, 0x0703f040, 0x07001fc0, 0x07001fc0, 0x0703ffc0, 0x0703ffc0,
+  0x06040000, 0x06040000, 0x06040000, 0x06040000, 0x06fc0000, 0x06fc0000, 0x06fc0000, 0x06fc0000,
+  0x07040040, 0x07040040, 0x07fc0040, 0x07fc0040, 0x07040fc0, 0x07040fc0, 0x07fc0fc0, 0x07fc0fc0,
+  0x06001000, 0x06001000, 0x06001000, 0x06001000, 0x0603f000, 0x0603f000, 0x0603f000, 0x0603f000,
+  0x06000040, 0x06000040, 0x06000040, 0x06000040, 0x06000fc0, 0x06000fc0, 0x06000fc0, 0x06000fc0,
+  0x27041042, 0x27041042, 0x27042041, 0x27042041, 0x27041081, 0x27041081, 0x27081041, 0x27081041,
+  0x27001042, 0x27001042, 0x27040042, 0x27040042, 0x27001081, 0x27001081, 0x27041002, 0x27041002,
+  0x27042040, 0x27042040, 0x28081040, 0x28002041, 0x28041080, 0x28081001, 0x28040081, 0x28080041,
+  0x28042001, 0x28000042, 0x28001002, 0x28000081, 0x28040002, 0x28080040, 0x28001080, 0x28081000,
+  0x28002040, 0x28040080, 0x28080001, 0x28042000, 0x28002001, 0x28000002, 0x28080000, 0x80010100,
+  0x80010102, 0x80010104, 0x80010106, 0x80020108, 0x8002010c, 0x80020110, 0x80030114, 0x8004011c,
+  0x21000080, 0x21002000, 0x21042081, 0x21041082, 0x21042042, 0x21082041, 0x21081081, 0x21081042,
+  0x22002081, 0x22001082, 0x22002042, 0x22042080, 0x22082040, 0x22040082, 0x22081080, 0x22042002,
+  0x22082001, 0x22042082, 0x22080081, 0x22081002, 0x22080042, 0x22080042, 0x22082081, 0x22082081,
+  0x23082042, 0x23081082, 0x23002080, 0x23000082, 0x23082000, 0x23082000, 0x23002002, 0x23002002,
+  0x23080080, 0x23080080, 0x23080002, 0x23080002, 0x23082082, 0x23082082, 0x23082080, 0x23082080,
+  0x23002082, 0x23002082, 0x24080082, 0x24082002
+};
+
+const UINT HuffmanLookup_5[328] =
+{
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f,
+  0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f,
+  0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001,
+  0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001,
+  0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040,
+  0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040,
+  0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0,
+  0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0,
+  0x05000fc1, 0x05000fc1, 0x05000fc1, 0x05000fc1, 0x05000fc1, 0x05000fc1, 0x05000fc1, 0x05000fc1,
+  0x0500007f, 0x0500007f, 0x0500007f, 0x0500007f, 0x0500007f, 0x0500007f, 0x0500007f, 0x0500007f,
+  0x05000fff, 0x05000fff, 0x05000fff, 0x05000fff, 0x05000fff, 0x05000fff, 0x05000fff, 0x05000fff,
+  0x05000041, 0x05000041, 0x05000041, 0x05000041, 0x05000041, 0x05000041, 0x05000041, 0x05000041,
+  0x0700003e, 0x0700003e, 0x07000080, 0x07000080, 0x07000002, 0x07000002, 0x07000f80, 0x07000f80,
+  0x08000ffe, 0x08000042, 0x08000fbf, 0x08000081, 0x0800007e, 0x08000fc2, 0x080000bf, 0x08000f81,
+  0x0800003d, 0x08000003, 0x08000f40, 0x080000c0, 0x80010100, 0x80010102, 0x80010104, 0x80010106,
+  0x80010108, 0x8001010a, 0x8002010c, 0x80020110, 0x80020114, 0x80030118, 0x80030120, 0x80050128,
+  0x01000ffd, 0x010000c1, 0x01000043, 0x01000f7f, 0x0100007d, 0x01000fc3, 0x01000f41, 0x010000ff,
+  0x010000be, 0x01000082, 0x01000fbe, 0x01000f82, 0x02000fbd, 0x02000f83, 0x020000fe, 0x02000f42,
+  0x02000083, 0x020000c2, 0x020000bd, 0x02000f7e, 0x02000f00, 0x0200003c, 0x02000044, 0x02000004,
+  0x03000ffc, 0x03000100, 0x03000fc4, 0x03000f3f, 0x03000101, 0x0300013f, 0x0300007c, 0x03000f01,
+  0x03000f43, 0x03000f7d, 0x030000fd, 0x0300013e, 0x03000fbc, 0x03000084, 0x03000f02, 0x03000102,
+  0x030000c3, 0x030000c3, 0x030000c3, 0x030000c3, 0x030000bc, 0x030000bc, 0x030000bc, 0x030000bc,
+  0x04000f3e, 0x04000f3e, 0x04000f84, 0x04000f84, 0x04000f03, 0x04000f03, 0x04000f7c, 0x04000f7c,
+  0x040000fc, 0x040000fc, 0x04000103, 0x04000103, 0x0400013d, 0x0400013d, 0x040000c4, 0x040000c4,
+  0x04000f44, 0x04000f44, 0x04000f3d, 0x04000f3d, 0x05000f04, 0x0500013c, 0x05000104, 0x05000f3c
+};
+
+const UINT HuffmanLookup_6[294] =
+{
+  0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000,
+  0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000,
+  0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001,
+  0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001,
+  0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0,
+  0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0,
+  0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040,
+  0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040,
+  0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f,
+  0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f,
+  0x04000041, 0x04000041, 0x04000041, 0x04000041, 0x04000041, 0x04000041, 0x04000041, 0x04000041,
+  0x04000041, 0x04000041, 0x04000041, 0x04000041, 0x04000041, 0x04000041, 0x04000041, 0x04000041,
+  0x0400007f, 0x0400007f, 0x0400007f, 0x0400007f, 0x0400007f, 0x0400007f, 0x0400007f, 0x0400007f,
+  0x0400007f, 0x0400007f, 0x0400007f, 0x0400007f, 0x0400007f, 0x0400007f, 0x0400007f, 0x0400007f,
+  0x04000fc1, 0x04000fc1, 0x04000fc1, 0x04000fc1, 0x04000fc1, 0x04000fc1, 0x04000fc1, 0x04000fc1,
+  0x04000fc1, 0x04000fc1, 0x04000fc1, 0x04000fc1, 0x04000fc1, 0x04000fc1, 0x04000fc1, 0x04000fc1,
+  0x04000fff, 0x04000fff, 0x04000fff, 0x04000fff, 0x04000fff, 0x04000fff, 0x04000fff, 0x04000fff,
+  0x04000fff, 0x04000fff, 0x04000fff, 0x04000fff, 0x04000fff, 0x04000fff, 0x04000fff, 0x04000fff,
+  0x06000fc2, 0x06000fc2, 0x06000fc2, 0x06000fc2, 0x06000042, 0x06000042, 0x06000042, 0x06000042,
+  0x0600007e, 0x0600007e, 0x0600007e, 0x0600007e, 0x06000ffe, 0x06000ffe, 0x06000ffe, 0x06000ffe,
+  0x0600003e, 0x0600003e, 0x0600003e, 0x0600003e, 0x060000bf, 0x060000bf, 0x060000bf, 0x060000bf,
+  0x06000002, 0x06000002, 0x06000002, 0x06000002, 0x06000f81, 0x06000f81, 0x06000f81, 0x06000f81,
+  0x06000081, 0x06000081, 0x06000081, 0x06000081, 0x06000f80, 0x06000f80, 0x06000f80, 0x06000f80,
+  0x06000fbf, 0x06000fbf, 0x06000fbf, 0x06000fbf, 0x06000080, 0x06000080, 0x06000080, 0x06000080,
+  0x06000f82, 0x06000f82, 0x06000f82, 0x06000f82, 0x060000be, 0x060000be, 0x060000be, 0x060000be,
+  0x06000fbe, 0x06000fbe, 0x06000fbe, 0x06000fbe, 0x06000082, 0x06000082, 0x06000082, 0x06000082,
+  0x0700007d, 0x0700007d, 0x07000043, 0x07000043, 0x07000fc3, 0x07000fc3, 0x070000ff, 0x070000ff,
+  0x07000ffd, 0x07000ffd, 0x070000c1, 0x070000c1, 0x07000f41, 0x07000f41, 0x07000f7f, 0x07000f7f,
+  0x07000003, 0x07000003, 0x0700003d, 0x0700003d, 0x07000f40, 0x07000f40, 0x070000c0, 0x070000c0,
+  0x07000083, 0x07000083, 0x08000fbd, 0x080000fe, 0x080000c2, 0x08000f83, 0x08000f42, 0x08000f7e,
+  0x080000bd, 0x080000c3, 0x80010100, 0x80010102, 0x80010104, 0x80010106, 0x80010108, 0x8001010a,
+  0x8001010c, 0x8001010e, 0x80010110, 0x80010112, 0x80010114, 0x80020116, 0x8002011a, 0x8003011e,
+  0x01000f43, 0x01000f7d, 0x010000fd, 0x01000f01, 0x01000f3f, 0x01000044, 0x0100007c, 0x01000ffc,
+  0x01000101, 0x01000fc4, 0x0100013f, 0x01000f00, 0x010000bc, 0x01000fbc, 0x01000102, 0x01000f3e,
+  0x0100003c, 0x01000084, 0x01000f84, 0x0100013e, 0x01000004, 0x01000f02, 0x01000100, 0x01000100,
+  0x02000f3d, 0x0200013d, 0x02000f03, 0x02000f44, 0x02000103, 0x020000c4, 0x020000fc, 0x020000fc,
+  0x02000f7c, 0x02000f7c, 0x03000104, 0x0300013c, 0x03000f3c, 0x03000f04
+};
+
+const UINT HuffmanLookup_7[306] =
+{
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001,
+  0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001,
+  0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f,
+  0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f,
+  0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040,
+  0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040,
+  0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0,
+  0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0,
+  0x06000041, 0x06000041, 0x06000041, 0x06000041, 0x06000fc1, 0x06000fc1, 0x06000fc1, 0x06000fc1,
+  0x0600007f, 0x0600007f, 0x0600007f, 0x0600007f, 0x06000fff, 0x06000fff, 0x06000fff, 0x06000fff,
+  0x08000042, 0x08000fc2, 0x0800007e, 0x08000ffe, 0x08000081, 0x08000f81, 0x080000bf, 0x08000fbf,
+  0x07000002, 0x07000002, 0x0700003e, 0x0700003e, 0x07000080, 0x07000080, 0x07000f80, 0x07000f80,
+  0x27000043, 0x27000043, 0x270000c1, 0x270000c1, 0x27000082, 0x27000082, 0x08000003, 0x0800003d,
+  0x080000c0, 0x08000f40, 0x280000c2, 0x28000083, 0x28000101, 0x28000044, 0x28000141, 0x28000045,
+  0x280000c3, 0x28000102, 0x28000100, 0x28000004, 0x80010100, 0x80010102, 0x80010104, 0x80010106,
+  0x80010108, 0x8001010a, 0x8001010c, 0x8002010e, 0x80020112, 0x80020116, 0x8003011a, 0x80040122,
+  0x21000084, 0x21000142, 0x21000085, 0x21000140, 0x21000046, 0x21000005, 0x21000181, 0x210000c4,
+  0x21000143, 0x21000103, 0x210000c5, 0x21000182, 0x21000086, 0x210001c1, 0x22000183, 0x22000180,
+  0x22000006, 0x22000104, 0x22000047, 0x22000144, 0x22000087, 0x22000105, 0x220000c6, 0x220001c2,
+  0x220000c7, 0x22000106, 0x22000145, 0x22000145, 0x22000184, 0x22000184, 0x220001c3, 0x220001c3,
+  0x23000007, 0x230001c0, 0x23000146, 0x23000146, 0x23000185, 0x23000185, 0x23000107, 0x23000107,
+  0x230001c4, 0x230001c4, 0x230001c5, 0x230001c5, 0x23000147, 0x23000147, 0x24000187, 0x24000186,
+  0x240001c6, 0x240001c7
+};
+
+const UINT HuffmanLookup_8[268] =
+{
+  0x05000041, 0x05000041, 0x05000041, 0x05000041, 0x05000041, 0x05000041, 0x05000041, 0x05000041,
+  0x05000fc1, 0x05000fc1, 0x05000fc1, 0x05000fc1, 0x05000fc1, 0x05000fc1, 0x05000fc1, 0x05000fc1,
+  0x0500007f, 0x0500007f, 0x0500007f, 0x0500007f, 0x0500007f, 0x0500007f, 0x0500007f, 0x0500007f,
+  0x05000fff, 0x05000fff, 0x05000fff, 0x05000fff, 0x05000fff, 0x05000fff, 0x05000fff, 0x05000fff,
+  0x06000042, 0x06000042, 0x06000042, 0x06000042, 0x06000fc2, 0x06000fc2, 0x06000fc2, 0x06000fc2,
+  0x0600007e, 0x0600007e, 0x0600007e, 0x0600007e, 0x06000ffe, 0x06000ffe, 0x06000ffe, 0x06000ffe,
+  0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001, 0x05000001,
+  0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f, 0x0500003f,
+  0x06000081, 0x06000081, 0x06000081, 0x06000081, 0x06000f81, 0x06000f81, 0x06000f81, 0x06000f81,
+  0x060000bf, 0x060000bf, 0x060000bf, 0x060000bf, 0x06000fbf, 0x06000fbf, 0x06000fbf, 0x06000fbf,
+  0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040, 0x05000040,
+  0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0, 0x05000fc0,
+  0x06000082, 0x06000082, 0x06000082, 0x06000082, 0x06000f82, 0x06000f82, 0x06000f82, 0x06000f82,
+  0x060000be, 0x060000be, 0x060000be, 0x060000be, 0x06000fbe, 0x06000fbe, 0x06000fbe, 0x06000fbe,
+  0x05000000, 0x05000000, 0x05000000, 0x05000000, 0x05000000, 0x05000000, 0x05000000, 0x05000000,
+  0x06000002, 0x06000002, 0x06000002, 0x06000002, 0x0600003e, 0x0600003e, 0x0600003e, 0x0600003e,
+  0x06000080, 0x06000080, 0x06000080, 0x06000080, 0x06000f80, 0x06000f80, 0x06000f80, 0x06000f80,
+  0x07000043, 0x07000043, 0x07000fc3, 0x07000fc3, 0x0700007d, 0x0700007d, 0x07000ffd, 0x07000ffd,
+  0x070000c1, 0x070000c1, 0x07000f41, 0x07000f41, 0x070000ff, 0x070000ff, 0x07000f7f, 0x07000f7f,
+  0x07000083, 0x07000083, 0x07000f83, 0x07000f83, 0x070000bd, 0x070000bd, 0x07000fbd, 0x07000fbd,
+  0x070000c2, 0x070000c2, 0x07000f42, 0x07000f42, 0x070000fe, 0x070000fe, 0x07000f7e, 0x07000f7e,
+  0x080000c3, 0x08000f43, 0x080000fd, 0x08000f7d, 0x08000044, 0x08000fc4, 0x0800007c, 0x08000ffc,
+  0x08000101, 0x08000f01, 0x0800013f, 0x08000f3f, 0x08000084, 0x08000f84, 0x080000bc, 0x08000fbc,
+  0x08000102, 0x08000f02, 0x0800013e, 0x08000f3e, 0x07000003, 0x07000003, 0x0700003d, 0x0700003d,
+  0x070000c0, 0x070000c0, 0x07000f40, 0x07000f40, 0x080000c4, 0x08000f44, 0x080000fc, 0x08000f7c,
+  0x08000103, 0x08000f03, 0x0800013d, 0x08000f3d, 0x08000085, 0x08000f85, 0x080000bb, 0x08000fbb,
+  0x27000045, 0x27000045, 0x27000142, 0x27000142, 0x27000141, 0x27000141, 0x270000c5, 0x270000c5,
+  0x27000143, 0x27000143, 0x27000104, 0x27000104, 0x27000105, 0x27000105, 0x08000100, 0x08000f00,
+  0x27000144, 0x27000144, 0x08000004, 0x0800003c, 0x27000182, 0x27000182, 0x27000086, 0x27000086,
+  0x27000046, 0x27000046, 0x27000181, 0x27000181, 0x28000183, 0x280000c6, 0x28000145, 0x28000005,
+  0x28000106, 0x28000140, 0x28000184, 0x28000047, 0x28000087, 0x280001c2, 0x28000146, 0x280000c7,
+  0x280001c1, 0x28000185, 0x280001c3, 0x80010100, 0x80010102, 0x80010104, 0x80010106, 0x80020108,
+  0x21000186, 0x21000107, 0x21000006, 0x210001c4, 0x21000180, 0x21000147, 0x21000187, 0x210001c6,
+  0x220001c5, 0x22000007, 0x220001c0, 0x220001c7
+};
+
+const UINT HuffmanLookup_9[510] =
+{
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+  0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001,
+  0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001, 0x04000001,
+  0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f,
+  0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f, 0x0400003f,
+  0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040,
+  0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040, 0x04000040,
+  0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0,
+  0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0, 0x04000fc0,
+  0x06000041, 0x06000041, 0x06000041, 0x06000041, 0x06000fc1, 0x06000fc1, 0x06000fc1, 0x06000fc1,
+  0x0600007f, 0x0600007f, 0x0600007f, 0x0600007f, 0x06000fff, 0x06000fff, 0x06000fff, 0x06000fff,
+  0x08000042, 0x08000fc2, 0x0800007e, 0x08000ffe, 0x08000081, 0x08000f81, 0x080000bf, 0x08000fbf,
+  0x07000002, 0x07000002, 0x0700003e, 0x0700003e, 0x07000080, 0x07000080, 0x07000f80, 0x07000f80,
+  0x27000043, 0x27000043, 0x27000082, 0x27000082, 0x270000c1, 0x270000c1, 0x28000003, 0x280000c0,
+  0x280000c2, 0x28000083, 0x28000101, 0x28000044, 0x28000102, 0x28000141, 0x80010100, 0x80010102,
+  0x80010104, 0x80010106, 0x80010108, 0x8002010a, 0x8002010e, 0x80020112, 0x80020116, 0x8002011a,
+  0x8003011e, 0x80030126, 0x8003012e, 0x80030136, 0x8004013e, 0x8004014e, 0x8005015e, 0x8007017e,
+  0x21000084, 0x210000c3, 0x21000100, 0x21000004, 0x21000045, 0x21000142, 0x21000181, 0x21000103,
+  0x21000085, 0x21000046, 0x210000c4, 0x210000c4, 0x22000140, 0x22000182, 0x22000005, 0x220001c1,
+  0x22000143, 0x22000201, 0x22000048, 0x22000104, 0x220000c5, 0x22000086, 0x22000047, 0x22000180,
+  0x22000088, 0x22000202, 0x22000183, 0x220001c2, 0x22000144, 0x22000049, 0x22000241, 0x22000241,
+  0x22000087, 0x22000087, 0x23000006, 0x23000105, 0x230000c6, 0x230000c8, 0x230001c0, 0x23000089,
+  0x23000203, 0x23000184, 0x230001c3, 0x23000200, 0x2300004a, 0x23000106, 0x23000242, 0x23000145,
+  0x23000008, 0x23000007, 0x230000c7, 0x2300008a, 0x230000c9, 0x23000108, 0x23000281, 0x23000107,
+  0x23000146, 0x23000185, 0x23000204, 0x230001c4, 0x23000243, 0x2300004b, 0x23000205, 0x23000205,
+  0x04000009, 0x04000037, 0x23000148, 0x23000148, 0x240000ca, 0x24000282, 0x24000240, 0x2400008b,
+  0x24000109, 0x24000186, 0x2400004c, 0x24000244, 0x24000188, 0x240002c1, 0x24000149, 0x2400010a,
+  0x240001c5, 0x24000147, 0x240002c2, 0x24000301, 0x2400008c, 0x240000cb, 0x24000283, 0x24000245,
+  0x240001c6, 0x240001c8, 0x2400010b, 0x24000280, 0x24000187, 0x240000cc, 0x0500000a, 0x05000036,
+  0x2400014a, 0x2400014a, 0x24000284, 0x24000284, 0x24000206, 0x24000206, 0x24000302, 0x24000302,
+  0x24000189, 0x24000189, 0x240001c9, 0x240001c9, 0x240002c4, 0x240002c4, 0x0500000b, 0x05000035,
+  0x24000246, 0x24000246, 0x240002c3, 0x240002c3, 0x24000285, 0x24000285, 0x25000208, 0x25000207,
+  0x2500014c, 0x25000303, 0x2500014b, 0x250001c7, 0x2500010c, 0x2500018b, 0x0700018a, 0x07000e8a,
+  0x070001b6, 0x07000eb6, 0x07000304, 0x07000d04, 0x0700033c, 0x07000d3c, 0x07000247, 0x07000dc7,
+  0x07000279, 0x07000df9, 0x070002c5, 0x07000d45, 0x070002fb, 0x07000d7b, 0x060002c0, 0x060002c0,
+  0x06000d40, 0x06000d40, 0x0700018c, 0x07000e8c, 0x070001b4, 0x07000eb4, 0x07000286, 0x07000d86,
+  0x070002ba, 0x07000dba, 0x0600000c, 0x0600000c, 0x06000034, 0x06000034, 0x070001ca, 0x07000e4a,
+  0x070001f6, 0x07000e76, 0x07000305, 0x07000d05, 0x0700033b, 0x07000d3b, 0x07000287, 0x07000d87,
+  0x070002b9, 0x07000db9, 0x07000209, 0x07000e09, 0x07000237, 0x07000e37, 0x06000300, 0x06000300,
+  0x06000d00, 0x06000d00, 0x070001cb, 0x07000e4b, 0x070001f5, 0x07000e75, 0x07000248, 0x07000dc8,
+  0x07000278, 0x07000df8, 0x07000249, 0x07000dc9, 0x07000277, 0x07000df7, 0x0700020a, 0x07000e0a,
+  0x07000236, 0x07000e36, 0x070002c7, 0x07000d47, 0x070002f9, 0x07000d79, 0x070001cc, 0x07000e4c,
+  0x070001f4, 0x07000e74, 0x070002c6, 0x07000d46, 0x070002fa, 0x07000d7a, 0x070002c8, 0x07000d48,
+  0x070002f8, 0x07000d78, 0x0700020b, 0x07000e0b, 0x07000235, 0x07000e35, 0x07000307, 0x07000d07,
+  0x07000339, 0x07000d39, 0x07000306, 0x07000d06, 0x0700033a, 0x07000d3a, 0x26000288, 0x26000288,
+  0x2600024a, 0x2600024a, 0x26000308, 0x26000308, 0x26000289, 0x26000289, 0x260002c9, 0x260002c9,
+  0x26000309, 0x26000309, 0x260002ca, 0x260002ca, 0x2600024c, 0x2600024c, 0x2600028a, 0x2600028a,
+  0x2600024b, 0x2600024b, 0x2600020c, 0x2600020c, 0x2600028b, 0x2600028b, 0x2600028c, 0x2600028c,
+  0x260002cc, 0x260002cc, 0x2700030a, 0x270002cb, 0x2700030b, 0x2700030c
+};
+
+const UINT HuffmanLookup_10[366] =
+{
+  0x06000041, 0x06000041, 0x06000041, 0x06000041, 0x06000fc1, 0x06000fc1, 0x06000fc1, 0x06000fc1,
+  0x0600007f, 0x0600007f, 0x0600007f, 0x0600007f, 0x06000fff, 0x06000fff, 0x06000fff, 0x06000fff,
+  0x06000081, 0x06000081, 0x06000081, 0x06000081, 0x06000f81, 0x06000f81, 0x06000f81, 0x06000f81,
+  0x060000bf, 0x060000bf, 0x060000bf, 0x060000bf, 0x06000fbf, 0x06000fbf, 0x06000fbf, 0x06000fbf,
+  0x06000042, 0x06000042, 0x06000042, 0x06000042, 0x06000fc2, 0x06000fc2, 0x06000fc2, 0x06000fc2,
+  0x0600007e, 0x0600007e, 0x0600007e, 0x0600007e, 0x06000ffe, 0x06000ffe, 0x06000ffe, 0x06000ffe,
+  0x07000082, 0x07000082, 0x07000f82, 0x07000f82, 0x070000be, 0x070000be, 0x07000fbe, 0x07000fbe,
+  0x06000001, 0x06000001, 0x06000001, 0x06000001, 0x0600003f, 0x0600003f, 0x0600003f, 0x0600003f,
+  0x06000040, 0x06000040, 0x06000040, 0x06000040, 0x06000fc0, 0x06000fc0, 0x06000fc0, 0x06000fc0,
+  0x070000c1, 0x070000c1, 0x07000f41, 0x07000f41, 0x070000ff, 0x070000ff, 0x07000f7f, 0x07000f7f,
+  0x07000083, 0x07000083, 0x07000f83, 0x07000f83, 0x070000bd, 0x070000bd, 0x07000fbd, 0x07000fbd,
+  0x07000043, 0x07000043, 0x07000fc3, 0x07000fc3, 0x0700007d, 0x0700007d, 0x07000ffd, 0x07000ffd,
+  0x070000c2, 0x070000c2, 0x07000f42, 0x07000f42, 0x070000fe, 0x070000fe, 0x07000f7e, 0x07000f7e,
+  0x070000c3, 0x070000c3, 0x07000f43, 0x07000f43, 0x070000fd, 0x070000fd, 0x07000f7d, 0x07000f7d,
+  0x07000002, 0x07000002, 0x0700003e, 0x0700003e, 0x07000080, 0x07000080, 0x07000f80, 0x07000f80,
+  0x08000102, 0x08000f02, 0x0800013e, 0x08000f3e, 0x08000084, 0x08000f84, 0x080000bc, 0x08000fbc,
+  0x08000101, 0x08000f01, 0x0800013f, 0x08000f3f, 0x08000044, 0x08000fc4, 0x0800007c, 0x08000ffc,
+  0x06000000, 0x06000000, 0x06000000, 0x06000000, 0x080000c4, 0x08000f44, 0x080000fc, 0x08000f7c,
+  0x08000103, 0x08000f03, 0x0800013d, 0x08000f3d, 0x07000003, 0x07000003, 0x0700003d, 0x0700003d,
+  0x070000c0, 0x070000c0, 0x07000f40, 0x07000f40, 0x08000104, 0x08000f04, 0x0800013c, 0x08000f3c,
+  0x08000142, 0x08000ec2, 0x0800017e, 0x08000efe, 0x08000085, 0x08000f85, 0x080000bb, 0x08000fbb,
+  0x27000141, 0x27000141, 0x27000045, 0x27000045, 0x270000c5, 0x270000c5, 0x27000143, 0x27000143,
+  0x27000105, 0x27000105, 0x27000144, 0x27000144, 0x27000086, 0x27000086, 0x27000182, 0x27000182,
+  0x270000c6, 0x270000c6, 0x08000004, 0x0800003c, 0x27000046, 0x27000046, 0x08000100, 0x08000f00,
+  0x27000181, 0x27000181, 0x27000183, 0x27000183, 0x27000145, 0x27000145, 0x27000106, 0x27000106,
+  0x27000184, 0x27000184, 0x28000146, 0x28000087, 0x280001c3, 0x280001c2, 0x28000185, 0x28000088,
+  0x280000c7, 0x28000005, 0x28000047, 0x28000140, 0x28000048, 0x280001c1, 0x280000c8, 0x28000107,
+  0x280001c4, 0x28000202, 0x28000186, 0x28000147, 0x28000201, 0x28000203, 0x28000108, 0x28000204,
+  0x280001c5, 0x28000148, 0x28000205, 0x80010100, 0x80010102, 0x80010104, 0x80010106, 0x80010108,
+  0x8001010a, 0x8001010c, 0x8001010e, 0x80010110, 0x80010112, 0x80010114, 0x80010116, 0x80010118,
+  0x8001011a, 0x8001011c, 0x8002011e, 0x80020122, 0x80020126, 0x8002012a, 0x8002012e, 0x80020132,
+  0x80020136, 0x8002013a, 0x8002013e, 0x80020142, 0x80030146, 0x8003014e, 0x80030156, 0x8004015e,
+  0x21000187, 0x210001c6, 0x21000089, 0x21000006, 0x21000206, 0x210000c9, 0x21000243, 0x21000049,
+  0x21000242, 0x21000180, 0x21000188, 0x21000109, 0x21000244, 0x2100008a, 0x21000241, 0x210001c7,
+  0x210001c8, 0x21000149, 0x21000207, 0x210000ca, 0x21000245, 0x2100010a, 0x21000282, 0x2100004a,
+  0x21000283, 0x21000189, 0x21000246, 0x21000008, 0x21000284, 0x21000007, 0x2100008b, 0x2100008b,
+  0x22000247, 0x220000cb, 0x2200018a, 0x22000281, 0x2200004b, 0x220001c9, 0x220001c0, 0x22000208,
+  0x2200014a, 0x220002c3, 0x22000285, 0x22000248, 0x2200014b, 0x22000200, 0x2200010b, 0x220002c2,
+  0x22000287, 0x22000286, 0x220001ca, 0x220002c4, 0x220002c1, 0x2200008c, 0x22000209, 0x220000cc,
+  0x2200018b, 0x220002c5, 0x2200010c, 0x220001cb, 0x2200014c, 0x22000303, 0x220002c6, 0x22000009,
+  0x2200020a, 0x2200000a, 0x2200004c, 0x22000240, 0x22000304, 0x22000249, 0x2200018c, 0x2200018c,
+  0x22000302, 0x22000302, 0x22000288, 0x22000288, 0x23000289, 0x23000301, 0x2300020b, 0x230001cc,
+  0x230002c7, 0x23000305, 0x23000306, 0x2300024a, 0x230002c8, 0x2300020c, 0x23000280, 0x23000307,
+  0x2300000b, 0x2300028a, 0x2300024b, 0x2300028b, 0x230002c0, 0x230002cb, 0x230002c9, 0x230002c9,
+  0x230002ca, 0x230002ca, 0x0400000c, 0x04000034, 0x23000308, 0x23000308, 0x2400024c, 0x2400030a,
+  0x24000309, 0x2400030b, 0x240002cc, 0x24000300, 0x2400028c, 0x2400030c
+};
+
+const UINT HuffmanLookup_11[462] =
+{
+  0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000,
+  0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000, 0x04000000,
+  0x06000041, 0x06000041, 0x06000041, 0x06000041, 0x06000fc1, 0x06000fc1, 0x06000fc1, 0x06000fc1,
+  0x0600007f, 0x0600007f, 0x0600007f, 0x0600007f, 0x06000fff, 0x06000fff, 0x06000fff, 0x06000fff,
+  0x07000410, 0x07000410, 0x07000c10, 0x07000c10, 0x07000430, 0x07000430, 0x07000c30, 0x07000c30,
+  0x06000001, 0x06000001, 0x06000001, 0x06000001, 0x0600003f, 0x0600003f, 0x0600003f, 0x0600003f,
+  0x06000040, 0x06000040, 0x06000040, 0x06000040, 0x06000fc0, 0x06000fc0, 0x06000fc0, 0x06000fc0,
+  0x07000042, 0x07000042, 0x07000fc2, 0x07000fc2, 0x0700007e, 0x0700007e, 0x07000ffe, 0x07000ffe,
+  0x07000081, 0x07000081, 0x07000f81, 0x07000f81, 0x070000bf, 0x070000bf, 0x07000fbf, 0x07000fbf,
+  0x07000082, 0x07000082, 0x07000f82, 0x07000f82, 0x070000be, 0x070000be, 0x07000fbe, 0x07000fbe,
+  0x080000c1, 0x08000f41, 0x080000ff, 0x08000f7f, 0x08000043, 0x08000fc3, 0x0800007d, 0x08000ffd,
+  0x08000083, 0x08000f83, 0x080000bd, 0x08000fbd, 0x07000002, 0x07000002, 0x0700003e, 0x0700003e,
+  0x080000c2, 0x08000f42, 0x080000fe, 0x08000f7e, 0x07000080, 0x07000080, 0x07000f80, 0x07000f80,
+  0x080000c3, 0x08000f43, 0x080000fd, 0x08000f7d, 0x27000044, 0x27000044, 0x27000101, 0x27000101,
+  0x27000084, 0x27000084, 0x27000102, 0x27000102, 0x270000c4, 0x270000c4, 0x27000103, 0x27000103,
+  0x08000003, 0x0800003d, 0x080000c0, 0x08000f40, 0x27000045, 0x27000045, 0x27000085, 0x27000085,
+  0x27000142, 0x27000142, 0x27000104, 0x27000104, 0x27000141, 0x27000141, 0x270000c5, 0x270000c5,
+  0x27000143, 0x27000143, 0x27000105, 0x27000105, 0x28000144, 0x28000086, 0x28000182, 0x28000046,
+  0x280000c6, 0x28000183, 0x28000181, 0x28000404, 0x28000403, 0x28000150, 0x280000d0, 0x28000110,
+  0x28000106, 0x28000190, 0x28000004, 0x28000184, 0x28000100, 0x28000402, 0x28000145, 0x28000405,
+  0x280001d0, 0x28000090, 0x28000210, 0x280001c2, 0x28000087, 0x280001c3, 0x28000146, 0x28000185,
+  0x28000406, 0x28000290, 0x280000c7, 0x28000047, 0x28000250, 0x28000407, 0x28000401, 0x280001c1,
+  0x280001c4, 0x280002d0, 0x28000107, 0x28000310, 0x28000408, 0x28000050, 0x28000186, 0x28000409,
+  0x28000202, 0x280001c5, 0x2800040a, 0x28000350, 0x280000c8, 0x28000088, 0x28000203, 0x28000005,
+  0x28000390, 0x2800040b, 0x28000147, 0x28000204, 0x280001c6, 0x28000187, 0x28000140, 0x80010100,
+  0x80010102, 0x80010104, 0x80010106, 0x80010108, 0x8001010a, 0x8001010c, 0x8001010e, 0x80010110,
+  0x80010112, 0x80010114, 0x80010116, 0x80010118, 0x8001011a, 0x8001011c, 0x8001011e, 0x80010120,
+  0x80010122, 0x80010124, 0x80010126, 0x80010128, 0x8001012a, 0x8001012c, 0x8001012e, 0x80010130,
+  0x80010132, 0x80010134, 0x80020136, 0x8002013a, 0x8002013e, 0x80020142, 0x80020146, 0x8002014a,
+  0x8002014e, 0x80020152, 0x80020156, 0x8002015a, 0x8002015e, 0x80020162, 0x80020166, 0x8002016a,
+  0x8002016e, 0x80020172, 0x80020176, 0x8002017a, 0x8002017e, 0x80020182, 0x80020186, 0x8002018a,
+  0x8002018e, 0x80020192, 0x80030196, 0x8003019e, 0x800301a6, 0x800301ae, 0x800301b6, 0x800401be,
+  0x21000108, 0x210003d0, 0x2100040c, 0x21000201, 0x21000048, 0x2100040e, 0x21000205, 0x2100040d,
+  0x21000243, 0x21000148, 0x210001c7, 0x21000242, 0x21000188, 0x21000089, 0x210000c9, 0x2100040f,
+  0x21000244, 0x21000206, 0x21000006, 0x21000109, 0x21000245, 0x210001c8, 0x21000207, 0x21000241,
+  0x210000ca, 0x21000180, 0x2100008a, 0x21000049, 0x21000149, 0x21000284, 0x21000282, 0x21000189,
+  0x21000283, 0x21000246, 0x2100010a, 0x21000208, 0x2100014a, 0x210001c9, 0x210000cb, 0x21000281,
+  0x21000007, 0x2100018a, 0x21000247, 0x210002c3, 0x21000285, 0x2100004a, 0x210002c4, 0x2100008b,
+  0x2100008d, 0x21000286, 0x210000cd, 0x210002c2, 0x21000010, 0x210002c5, 0x2100014b, 0x2100014b,
+  0x2200010b, 0x22000209, 0x22000287, 0x22000248, 0x22000400, 0x22000344, 0x220001c0, 0x22000343,
+  0x2200018b, 0x2200004d, 0x2200010d, 0x220000cc, 0x22000342, 0x2200014d, 0x22000288, 0x220002c6,
+  0x2200020a, 0x220001ca, 0x2200008e, 0x2200010c, 0x220002c1, 0x22000304, 0x2200004b, 0x22000303,
+  0x22000341, 0x2200008c, 0x220002c7, 0x22000383, 0x22000305, 0x22000345, 0x2200010e, 0x22000384,
+  0x220001cb, 0x220000ce, 0x2200014c, 0x2200018d, 0x2200018c, 0x22000008, 0x2200020b, 0x22000302,
+  0x22000249, 0x2200014e, 0x22000346, 0x2200028a, 0x2200008f, 0x220002c8, 0x22000289, 0x2200018e,
+  0x2200024a, 0x22000385, 0x2200024b, 0x2200004e, 0x22000382, 0x22000306, 0x22000301, 0x2200020d,
+  0x22000200, 0x220001cd, 0x22000307, 0x220001cc, 0x22000347, 0x220000cf, 0x2200004c, 0x22000386,
+  0x220003c2, 0x2200014f, 0x2200010f, 0x22000381, 0x220002c9, 0x220003c4, 0x220001ce, 0x22000348,
+  0x2200024d, 0x22000308, 0x220003c5, 0x220003c3, 0x220002ca, 0x2200028b, 0x2200020c, 0x2200018f,
+  0x220001cf, 0x22000388, 0x2200004f, 0x22000387, 0x22000009, 0x22000240, 0x22000349, 0x22000309,
+  0x2200024c, 0x2200020e, 0x2200034a, 0x2200024e, 0x2200028c, 0x220003c6, 0x220003c7, 0x220003c7,
+  0x23000389, 0x2300020f, 0x230002cb, 0x2300038b, 0x230003c1, 0x2300030a, 0x2300038a, 0x230002cd,
+  0x2300028d, 0x2300034b, 0x2300030b, 0x230003c8, 0x230002ce, 0x2300030d, 0x2300034c, 0x2300024f,
+  0x2300028e, 0x2300000a, 0x230002cc, 0x230003c9, 0x23000280, 0x2300030c, 0x2300000b, 0x2300038c,
+  0x230003ca, 0x2300034d, 0x23000340, 0x2300030e, 0x2300028f, 0x230002cf, 0x230003cb, 0x2300034e,
+  0x2300000d, 0x230002c0, 0x2300038d, 0x2300030f, 0x2300034f, 0x230003cc, 0x0400000e, 0x04000032,
+  0x2300038e, 0x2300038e, 0x230003cd, 0x230003cd, 0x0400000c, 0x04000034, 0x230003ce, 0x230003ce,
+  0x24000380, 0x24000300, 0x2400038f, 0x2400000f, 0x240003c0, 0x240003cf
+};
+
+
+/* .CodeBook = HuffmanCodeBook_x, .LookupTable = HuffmanLookup_x, .Dimension = 4, .numBits = 2, .Offset =  0  */
 const CodeBookDescription AACcodeBookDescriptionTable[13] = {
-  { NULL, 0, 0,  0 },
-  { HuffmanCodeBook_1,  4, 2, 1 },
-  { HuffmanCodeBook_2,  4, 2, 1 },
-  { HuffmanCodeBook_3,  4, 2, 0 },
-  { HuffmanCodeBook_4,  4, 2, 0 },
-  { HuffmanCodeBook_5,  2, 4, 4 },
-  { HuffmanCodeBook_6,  2, 4, 4 },
-  { HuffmanCodeBook_7,  2, 4, 0 },
-  { HuffmanCodeBook_8,  2, 4, 0 },
-  { HuffmanCodeBook_9,  2, 4, 0 },
-  { HuffmanCodeBook_10, 2, 4, 0 },
-  { HuffmanCodeBook_11, 2, 5, 0 },
-  { HuffmanCodeBook_SCL, 1, 8, 60 }
+  { NULL, NULL, 0, 0,  0 },
+  { HuffmanCodeBook_1,  HuffmanLookup_1,  4, 2, 1 },
+  { HuffmanCodeBook_2,  HuffmanLookup_2,  4, 2, 1 },
+  { HuffmanCodeBook_3,  HuffmanLookup_3,  4, 2, 0 },
+  { HuffmanCodeBook_4,  HuffmanLookup_4,  4, 2, 0 },
+  { HuffmanCodeBook_5,  HuffmanLookup_5,  2, 4, 4 },
+  { HuffmanCodeBook_6,  HuffmanLookup_6,  2, 4, 4 },
+  { HuffmanCodeBook_7,  HuffmanLookup_7,  2, 4, 0 },
+  { HuffmanCodeBook_8,  HuffmanLookup_8,  2, 4, 0 },
+  { HuffmanCodeBook_9,  HuffmanLookup_9,  2, 4, 0 },
+  { HuffmanCodeBook_10, HuffmanLookup_10, 2, 4, 0 },
+  { HuffmanCodeBook_11, HuffmanLookup_11, 2, 5, 0 },
+  { HuffmanCodeBook_SCL, NULL, 1, 8, 60 }
 };
 
-const CodeBookDescription AACcodeBookDescriptionSCL = { HuffmanCodeBook_SCL, 1, 8, 60 };
+const CodeBookDescription AACcodeBookDescriptionSCL = { HuffmanCodeBook_SCL, NULL, 1, 8, 60 };
 
 
 
@@ -128,9 +128,30 @@ enum {
   HuffmanEntries = (1 << HuffmanBits)
 };
 
+/*
+  Spectral Huffman lookup tables (codebooks 1..11)
+
+  A root table of 2^HuffmanLookupBits entries is indexed with the next
+  HuffmanLookupBits bits of the stream, longer codewords continue in a
+  second level table that is appended to the root table.
+
+  Bit 31:      = 1=SUBTABLE, 0=CODEWORD
+  SUBTABLE:
+  Bit 0..15:   = offset of the second level table
+  Bit 16..19:  = number of bits indexing the second level table
+  CODEWORD:
+  Bit 0..23:   = up to 4 values, 6 bit two's complement each, value 0 in bits 0..5
+  Bit 24..28:  = number of bits consumed in this level (codeword and folded sign bits)
+  Bit 29:      = 1=sign bits of the nonzero values follow, 0=values are signed already
+*/
+#define HuffmanLookupBits     8
+#define HuffmanLookupSubTable 0x80000000
+#define HuffmanLookupSignBits 0x20000000
+
 typedef struct
 {
   const USHORT (*CodeBook)[HuffmanEntries];
+  const UINT *LookupTable;                 /*!< Spectral lookup table, NULL for the scalefactor codebook */
   UCHAR Dimension;
   UCHAR numBits;
   UCHAR Offset;
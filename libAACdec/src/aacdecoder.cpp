@@ -737,6 +737,7 @@ LINKSPEC_CPP HANDLE_AACDECODER CAacDecoder_Open(TRANSPORT_TYPE bsFormat)    /*!<
 
   /* set default output mode */
   self->outputInterleaved = 1;  /* interleaved */
+  self->outputInPlace = 0;      /* decode into internal buffer */
 
   /* initialize anc data */
   CAacDecoder_AncDataInit(&self->ancData, NULL, 0);
@@ -775,6 +776,52 @@ bail:
   return NULL;
 }
 
+/* (Re)create worker pool and scratch memory for channel-parallel processing */
+LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_InitWorkers(HANDLE_AACDECODER self, const INT nThreads)
+{
+  AAC_DECODER_ERROR err = AAC_DEC_OK;
+  INT n, nWorkers;
+
+  nWorkers = fixMax(1, fixMin(nThreads, FDK_MAX_WORKERS));
+
+  if (nWorkers != FDKworkerPoolGetWorkers(self->hWorkerPool)) {
+    FDKworkerPoolClose(&self->hWorkerPool);
+
+    if (FDKworkerPoolOpen(&self->hWorkerPool, nWorkers) != 0) {
+      err = AAC_DEC_OUT_OF_MEMORY;
+    }
+  }
+  nWorkers = FDKworkerPoolGetWorkers(self->hWorkerPool);
+
+  for (n=0; (n<nWorkers) && (nWorkers>1); n++) {
+    if (self->pMdctOutTemp[n] == NULL) {
+      self->pMdctOutTemp[n] = GetMdctOutTempWorker(n);
+      if (self->pMdctOutTemp[n] == NULL) {
+        err = AAC_DEC_OUT_OF_MEMORY;
+      }
+    }
+  }
+
+  if (sbrDecoder_SetWorkerPool(self->hSbrDecoder, self->hWorkerPool) == SBRDEC_MEM_ALLOC_FAILED) {
+    err = AAC_DEC_OUT_OF_MEMORY;
+  }
+
+  if (err != AAC_DEC_OK) {
+    /* Fall back to single-threaded decoding. */
+    FDKworkerPoolClose(&self->hWorkerPool);
+    sbrDecoder_SetWorkerPool(self->hSbrDecoder, NULL);
+    nWorkers = 1;
+  }
+
+  for (n=(nWorkers>1) ? nWorkers : 0; n<FDK_MAX_WORKERS; n++) {
+    if (self->pMdctOutTemp[n] != NULL) {
+      FreeMdctOutTempWorker(&self->pMdctOutTemp[n]);
+    }
+  }
+
+  return err;
+}
+
 /* Destroy aac decoder */
 LINKSPEC_CPP void CAacDecoder_Close(HANDLE_AACDECODER self)
 {
@@ -783,6 +830,13 @@ LINKSPEC_CPP void CAacDecoder_Close(HANDLE_AACDECODER self)
   if (self == NULL)
     return;
 
+  FDKworkerPoolClose(&self->hWorkerPool);
+  for (ch=0; ch<FDK_MAX_WORKERS; ch++) {
+    if (self->pMdctOutTemp[ch] != NULL) {
+      FreeMdctOutTempWorker(&self->pMdctOutTemp[ch]);
+    }
+  }
+
   for (ch=0; ch<(8); ch++) {
     if (self->pAacDecoderStaticChannelInfo[ch] != NULL) {
       if (self->pAacDecoderStaticChannelInfo[ch]->pOverlapBuffer != NULL) {
@@ -1111,6 +1165,71 @@ bail:
 }
 
 
+/* Context of the channel-parallel inverse transform */
+typedef struct {
+  HANDLE_AACDECODER        self;
+  CAacDecoderChannelInfo  *pAacDecoderChannelInfo[(8)];  /* channel data in canonical MPEG channel order */
+  INT_PCM                 *pTimeData[(8)];               /* output position of each channel */
+  INT                      nChannels;
+  INT                      parallel;                     /* channels are transformed on the worker pool */
+  INT                      stride;
+  INT                      frameOk;
+  UINT                     flags;
+} FREQ_TO_TIME_JOB;
+
+/*!
+  \brief Inverse transform of one channel
+
+  Touches the data of channel c and the transform scratch memory of the executing worker only.
+  Concealment and DRC must have been applied to the channel before.
+*/
+static void CAacDecoder_FrequencyToTimeJob(void *pCtx, INT c, INT worker)
+{
+  FREQ_TO_TIME_JOB *job = (FREQ_TO_TIME_JOB*)pCtx;
+  HANDLE_AACDECODER self = job->self;
+  CAacDecoderChannelInfo *pAacDecoderChannelInfo = job->pAacDecoderChannelInfo[c];
+  FIXP_DBL *pWorkBuffer = self->aacCommonData.workBufferCore1->mdctOutTemp;
+
+  /* mdctOutTemp overlays the dynamic channel data. Only the last channel is transformed there
+     on the pool, leaving it in the same state as sequential decoding does. */
+  if ( job->parallel && (c < job->nChannels-1) ) {
+    pWorkBuffer = self->pMdctOutTemp[worker];
+  }
+
+  FDK_PROF_START(tImdct);
+  switch (pAacDecoderChannelInfo->renderMode)
+  {
+    case AACDEC_RENDER_IMDCT:
+      CBlock_FrequencyToTime(
+              self->pAacDecoderStaticChannelInfo[c],
+              pAacDecoderChannelInfo,
+              job->pTimeData[c],
+              self->streamInfo.aacSamplesPerFrame,
+              job->stride,
+              job->frameOk,
+              pWorkBuffer
+              );
+      break;
+    case AACDEC_RENDER_ELDFB:
+      CBlock_FrequencyToTimeLowDelay(
+              self->pAacDecoderStaticChannelInfo[c],
+              pAacDecoderChannelInfo,
+              job->pTimeData[c],
+              self->streamInfo.aacSamplesPerFrame,
+              job->stride
+              );
+      break;
+    default:
+      break;
+  }
+  FDK_PROF_STOP(FDK_PROF_DEC_IMDCT, tImdct);
+  if ( job->flags&AACDEC_FLUSH ) {
+      FDKmemclear(pAacDecoderChannelInfo->pSpectralCoefficient, sizeof(FIXP_DBL)*self->streamInfo.aacSamplesPerFrame);
+    FDKmemclear(self->pAacDecoderStaticChannelInfo[c]->pOverlapBuffer, OverlapBufferSize*sizeof(FIXP_DBL));
+  }
+}
+
+
 LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
         HANDLE_AACDECODER self,
         const UINT flags,
@@ -1679,8 +1798,32 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
     Inverse transform
   */
   {
+    FREQ_TO_TIME_JOB f2tJob;
     int stride, offset, c;
 
+    f2tJob.self      = self;
+    f2tJob.nChannels = aacChannels;
+    f2tJob.frameOk   = (self->frameOK && !(flags&AACDEC_CONCEAL));
+    f2tJob.flags     = flags;
+    f2tJob.parallel  = (self->hWorkerPool != NULL);
+
+    /* Channels can only be transformed in parallel if each of them owns its channel data and output position. */
+    if (f2tJob.parallel) {
+      UINT usedData = 0, usedOutput = 0;
+
+      for (c=0; c < aacChannels; c++) {
+        int ch  = (self->chMapping[c] >= aacChannels) ? c : self->chMapping[c];
+        int out = self->channelOutputMapping[chOutMapIdx][c];
+
+        if ( (out >= aacChannels) || (usedData & (1<<ch)) || (usedOutput & (1<<out)) ) {
+          f2tJob.parallel = 0;
+          break;
+        }
+        usedData   |= 1<<ch;
+        usedOutput |= 1<<out;
+      }
+    }
+
     /* Turn on/off DRC modules level normalization in digital domain depending on the limiter status. */
     aacDecoder_drcSetParam( self->hDrcInfo, APPLY_NORMALIZATION, (self->limiterEnableCurr) ? 0 : 1 );
     /* Extract DRC control data and map it to channels (without bitstream delay) */
@@ -1741,6 +1884,7 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
       /* The DRC module demands to be called with the gain field holding the gain scale. */
       self->extGain[0] = (FIXP_DBL)TDL_GAIN_SCALING;
       /* DRC processing */
+      FDK_PROF_START(tDrc);
       aacDecoder_drcApply (
               self->hDrcInfo,
               self->hSbrDecoder,
@@ -1751,41 +1895,35 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
               self->streamInfo.aacSamplesPerFrame,
               self->sbrEnabled
             );
+      FDK_PROF_STOP(FDK_PROF_DEC_DRC, tDrc);
 
       switch (pAacDecoderChannelInfo->renderMode)
       {
         case AACDEC_RENDER_IMDCT:
-          CBlock_FrequencyToTime(
-                  self->pAacDecoderStaticChannelInfo[c],
-                  pAacDecoderChannelInfo,
-                  pTimeData + offset,
-                  self->streamInfo.aacSamplesPerFrame,
-                  stride,
-                  (self->frameOK && !(flags&AACDEC_CONCEAL)),
-                  self->aacCommonData.workBufferCore1->mdctOutTemp
-                  );
           self->extGainDelay = self->streamInfo.aacSamplesPerFrame;
           break;
         case AACDEC_RENDER_ELDFB:
-          CBlock_FrequencyToTimeLowDelay(
-                  self->pAacDecoderStaticChannelInfo[c],
-                  pAacDecoderChannelInfo,
-                  pTimeData + offset,
-                  self->streamInfo.aacSamplesPerFrame,
-                  stride
-                  );
           self->extGainDelay = (self->streamInfo.aacSamplesPerFrame*2 -  self->streamInfo.aacSamplesPerFrame/2 - 1)/2;
           break;
         default:
           ErrorStatus = AAC_DEC_UNKNOWN;
           break;
       }
-      if ( flags&AACDEC_FLUSH ) {
-          FDKmemclear(pAacDecoderChannelInfo->pSpectralCoefficient, sizeof(FIXP_DBL)*self->streamInfo.aacSamplesPerFrame);
-        FDKmemclear(self->pAacDecoderStaticChannelInfo[c]->pOverlapBuffer, OverlapBufferSize*sizeof(FIXP_DBL));
+
+      f2tJob.stride = stride;
+      f2tJob.pAacDecoderChannelInfo[c] = pAacDecoderChannelInfo;
+      f2tJob.pTimeData[c] = pTimeData + offset;
+
+      if (!f2tJob.parallel) {
+        CAacDecoder_FrequencyToTimeJob(&f2tJob, c, 0);
       }
     }
 
+    /* The transforms of all channels are independent and run on the worker pool. */
+    if (f2tJob.parallel) {
+      FDKworkerPoolRun(self->hWorkerPool, CAacDecoder_FrequencyToTimeJob, &f2tJob, aacChannels);
+    }
+
 
     /* Extract DRC control data and map it to channels (with bitstream delay) */
     aacDecoder_drcEpilog (
@@ -1831,6 +1969,37 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
   return ErrorStatus;
 }
 
+/*!
+  \brief Allocate SBR memory for implicit SBR signaling
+
+  With implicit signaling the SBR elements are created while decoding the first frame which
+  carries SBR data. This function creates them in advance for all channel elements of the
+  current configuration, for example to determine the memory consumption of an instance.
+*/
+LINKSPEC_CPP void CAacDecoder_AllocImplicitSbr ( HANDLE_AACDECODER self )
+{
+  int el;
+
+  if ( (self->streamInfo.aot != AOT_AAC_LC) || (self->flags & AC_SBR_PRESENT) ) {
+    return;
+  }
+
+  for (el = 0; el < (8); el++) {
+    if (!IS_CHANNEL_ELEMENT(self->elements[el])) {
+      break;
+    }
+    sbrDecoder_InitElement(
+            self->hSbrDecoder,
+            self->streamInfo.aacSampleRate,
+            2*self->streamInfo.aacSampleRate,
+            self->streamInfo.aacSamplesPerFrame,
+            self->streamInfo.aot,
+            self->elements[el],
+            el
+            );
+  }
+}
+
 /*!
   \brief returns the streaminfo pointer
 
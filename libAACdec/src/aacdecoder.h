@@ -103,6 +103,8 @@ amm-info@iis.fraunhofer.de
 #include "block.h"
 
 #include "genericStds.h"
+#include "FDK_arena.h"
+#include "FDK_thread.h"
 
 
 #include "sbrdecoder.h"
@@ -168,6 +170,9 @@ struct AAC_DECODER_INSTANCE {
   INT                   nrOfLayers;
 
   INT                   outputInterleaved;           /*!< PCM output format (interleaved/none interleaved). */
+  INT                   outputInPlace;               /*!< Decode into client buffer if large enough. */
+
+  HANDLE_FDK_ARENA      hArena;                      /*!< Memory arena of this instance, NULL for heap memory. */
 
   HANDLE_TRANSPORTDEC   hInput;                      /*!< Transport layer handle. */
 
@@ -228,6 +233,13 @@ struct AAC_DECODER_INSTANCE {
 
   INT_PCM      pcmOutputBuffer[(8)*(2048)];
 
+  HANDLE_FDK_WORKERPOOL hWorkerPool;                 /*!< Channel-parallel inverse transform and SBR, NULL if single-threaded. */
+  FIXP_DBL    *pMdctOutTemp[FDK_MAX_WORKERS];        /*!< Inverse transform scratch memory of each worker, NULL if single-threaded. */
+
+#if defined(FDK_PROFILE)
+  FDK_PROF_STATS prof[FDK_MAX_WORKERS];              /*!< Timing statistics per worker.              */
+#endif
+
 };
 
 
@@ -315,6 +327,19 @@ LINKSPEC_H AAC_DECODER_ERROR CAacDecoder_DecodeFrame(
         const INT interleaved
         );
 
+/* Allocate SBR and PS memory which an AAC-LC stream may require for implicit SBR signaling */
+LINKSPEC_H void CAacDecoder_AllocImplicitSbr ( HANDLE_AACDECODER self );
+
+/*!
+  \brief (Re)create the worker pool and the scratch memory of its workers
+
+  \self decoder handle
+  \nThreads number of workers including the calling thread, 0 or 1: single-threaded
+
+  \return  Error code
+*/
+LINKSPEC_H AAC_DECODER_ERROR CAacDecoder_InitWorkers ( HANDLE_AACDECODER self, const INT nThreads );
+
 /* Destroy aac decoder */
 LINKSPEC_H void CAacDecoder_Close ( HANDLE_AACDECODER self );
 
@@ -124,6 +124,13 @@ static AAC_DECODER_ERROR
 setConcealMethod ( const HANDLE_AACDECODER  self,
                    const INT                method );
 
+/* Bind the memory arena of a decoder instance, if any, to the calling thread.
+   Returns the arena to be restored with FDKarenaBind(). */
+static HANDLE_FDK_ARENA aacDecoder_EnterArena( const HANDLE_AACDECODER self )
+{
+  return (self->hArena != NULL) ? FDKarenaBind(self->hArena) : FDKarenaGetBound();
+}
+
 
 LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_GetFreeBytes ( const HANDLE_AACDECODER  self, UINT *pFreeBytes){
 
@@ -164,6 +171,7 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_ConfigRaw (
   AAC_DECODER_ERROR err = AAC_DEC_OK;
   TRANSPORTDEC_ERROR   errTp;
   UINT layer, nrOfLayers = self->nrOfLayers;
+  HANDLE_FDK_ARENA hPrevArena = aacDecoder_EnterArena(self);
 
   for(layer = 0; layer < nrOfLayers; layer++){
     if(length[layer] > 0){
@@ -190,6 +198,8 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_ConfigRaw (
     }
   }
 
+  FDKarenaBind(hPrevArena);
+
   return err;
 }
 
@@ -428,6 +438,16 @@ aacDecoder_SetParam ( const HANDLE_AACDECODER  self,   /*!< Handle of the decode
     self->outputInterleaved = value;
     break;
 
+  case AAC_PCM_OUTPUT_IN_PLACE:
+    if (value < 0 || value > 1) {
+      return AAC_DEC_SET_PARAM_FAIL;
+    }
+    if (self == NULL) {
+      return AAC_DEC_INVALID_HANDLE;
+    }
+    self->outputInPlace = value;
+    break;
+
   case AAC_PCM_MIN_OUTPUT_CHANNELS:
     if (value < -1 || value > (8)) {
       return AAC_DEC_SET_PARAM_FAIL;
@@ -628,6 +648,20 @@ aacDecoder_SetParam ( const HANDLE_AACDECODER  self,   /*!< Handle of the decode
     errorStatus = setConcealMethod ( self, value );
     break;
 
+  case AAC_NUM_THREADS:
+    if (value < 0 || value > FDK_MAX_WORKERS) {
+      return AAC_DEC_SET_PARAM_FAIL;
+    }
+    if (self == NULL) {
+      return AAC_DEC_INVALID_HANDLE;
+    }
+    {
+      HANDLE_FDK_ARENA hPrevArena = aacDecoder_EnterArena(self);
+      errorStatus = CAacDecoder_InitWorkers(self, value);
+      FDKarenaBind(hPrevArena);
+    }
+    break;
+
   default:
     return AAC_DEC_SET_PARAM_FAIL;
   }  /* switch(param) */
@@ -705,6 +739,111 @@ bail:
   return aacDec;
 }
 
+LINKSPEC_CPP HANDLE_AACDECODER aacDecoder_OpenArena(TRANSPORT_TYPE transportFmt, UINT nrOfLayers, void *pArena, const UINT arenaSize)
+{
+  HANDLE_AACDECODER aacDec;
+  HANDLE_FDK_ARENA hArena, hPrevArena;
+
+  hArena = FDKarenaCreate(pArena, arenaSize);
+  if (hArena == NULL) {
+    return NULL;
+  }
+
+  hPrevArena = FDKarenaBind(hArena);
+  aacDec = aacDecoder_Open(transportFmt, nrOfLayers);
+  FDKarenaBind(hPrevArena);
+
+  if (aacDec != NULL) {
+    aacDec->hArena = hArena;
+  }
+
+  return aacDec;
+}
+
+/* Open, configure and close a decoder instance, so that the caller can measure its memory. */
+static AAC_DECODER_ERROR aacDecoder_OpenForMeasurement(TRANSPORT_TYPE transportFmt, UINT nrOfLayers, UCHAR *conf[], const UINT length[])
+{
+  HANDLE_AACDECODER aacDec;
+  AAC_DECODER_ERROR err = AAC_DEC_OK;
+
+  aacDec = aacDecoder_Open(transportFmt, nrOfLayers);
+  if (aacDec == NULL) {
+    return AAC_DEC_OUT_OF_MEMORY;
+  }
+
+  if ( (conf != NULL) && (length != NULL) ) {
+    err = aacDecoder_ConfigRaw(aacDec, conf, length);
+    if (err == AAC_DEC_OK) {
+      CAacDecoder_AllocImplicitSbr(aacDec);
+    }
+  }
+
+  aacDecoder_Close(aacDec);
+
+  return err;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_GetStats(HANDLE_AACDECODER self, FDK_PROF_STATS *pStats)
+{
+  if ( (self == NULL) || (pStats == NULL) ) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+
+  FDKmemclear(pStats, sizeof(FDK_PROF_STATS));
+#if defined(FDK_PROFILE)
+  FDKprofileAccumulate(pStats, self->prof, FDK_MAX_WORKERS);
+  return AAC_DEC_OK;
+#else
+  return AAC_DEC_SET_PARAM_FAIL;
+#endif
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_GetMemRequirements(TRANSPORT_TYPE transportFmt, UINT nrOfLayers, UCHAR *conf[], const UINT length[], FDK_MEM_INFO *pMemInfo)
+{
+  AAC_DECODER_ERROR err;
+  FDK_MEM_INFO *pPrevMemInfo;
+  INT prevShared;
+
+  if (pMemInfo == NULL) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+
+  /* Shared work buffers might already exist, allocate private ones to account for them. */
+  prevShared = FDKsetSharedOverlays(0);
+  pPrevMemInfo = FDKmemMeasure(pMemInfo);
+
+  err = aacDecoder_OpenForMeasurement(transportFmt, nrOfLayers, conf, length);
+
+  FDKmemMeasure(pPrevMemInfo);
+  FDKsetSharedOverlays(prevShared);
+
+  return err;
+}
+
+LINKSPEC_CPP INT aacDecoder_ShareWorkBuffers(const UINT enable)
+{
+  return FDKsetSharedOverlays((enable) ? 1 : 0);
+}
+
+LINKSPEC_CPP UINT aacDecoder_GetArenaSize(TRANSPORT_TYPE transportFmt, UINT nrOfLayers, UCHAR *conf[], const UINT length[])
+{
+  HANDLE_FDK_ARENA hPrevArena;
+  FDK_ARENA measure;
+  UINT size = 0;
+
+  /* Open and configure a decoder instance within a measuring arena. */
+  FDKarenaInitMeasure(&measure);
+  hPrevArena = FDKarenaBind(&measure);
+
+  if (aacDecoder_OpenForMeasurement(transportFmt, nrOfLayers, conf, length) == AAC_DEC_OK) {
+    size = FDKarenaGetRequiredSize(&measure);
+  }
+
+  FDKarenaBind(hPrevArena);
+
+  return size;
+}
+
 LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_Fill(
         HANDLE_AACDECODER   self,
         UCHAR              *pBuffer[],
@@ -784,19 +923,57 @@ static INT aacDecoder_EstimateNumberOfLostFrames(HANDLE_AACDECODER self)
   return n;
 }
 
-LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(
-        HANDLE_AACDECODER  self,
-        INT_PCM           *pTimeData_extern,
-        const INT          timeDataSize_extern,
-        const UINT         flags)
+/*!
+  \brief  Get the number of time samples the decoder may touch in its output buffer while
+          decoding one frame of the current configuration. Core decoding, SBR/PS, PCM
+          downmix/upmix and limiter all operate in place in that buffer.
+
+  \return Number of INT_PCM samples, 0 if no configuration is known yet.
+*/
+static INT aacDecoder_GetWorkBufferSize(HANDLE_AACDECODER self)
+{
+  INT nChannels, frameSize, minOutChannels = 0;
+
+  frameSize = self->streamInfo.aacSamplesPerFrame;
+  if (frameSize <= 0) {
+    return 0;
+  }
+  /* SBR may be signaled implicitly at any time: assume dual-rate, or 8:3 upsampling of 768 samples. */
+  frameSize = (frameSize == 768) ? 2048 : 2*frameSize;
+
+  /* In-band PCEs may change the channel count if no channel configuration is given.
+     PS turns a mono core signal into two channels. */
+  nChannels = (self->streamInfo.channelConfig == 0) ? (8) : fixMax(self->ascChannels, 2);
+
+  if (pcmDmx_GetParam(self->hPcmUtils, MIN_NUMBER_OF_OUTPUT_CHANNELS, &minOutChannels) == PCMDMX_OK) {
+    nChannels = fixMax(nChannels, minOutChannels);
+  }
+
+  return nChannels * frameSize;
+}
+
+/* State of one frame handed from aacDecoder_DecodeFrameCore() to aacDecoder_DecodeFramePost(). */
+typedef struct {
+    INT_PCM           *pTimeData;    /* Buffer the frame is decoded in, internal or client buffer. */
+    INT                nBits;        /* Valid input bits before decoding, for the bit rate statistics. */
+    INT                outputValid;  /* 0: skip post processing, the frame ends with ErrorStatus. */
+    AAC_DECODER_ERROR  ErrorStatus;
+} AACDEC_FRAME_STATE;
+
+/*!
+  \brief Core stage of a frame: transport, spectral decoding and frequency to time conversion.
+*/
+static void aacDecoder_DecodeFrameCore(
+        HANDLE_AACDECODER   self,
+        INT_PCM            *pTimeData_extern,
+        const INT           timeDataSize_extern,
+        const UINT          flags,
+        AACDEC_FRAME_STATE *pState)
 {
     AAC_DECODER_ERROR ErrorStatus;
     int fTpInterruption = 0;  /* Transport originated interruption detection. */
     int fTpConceal = 0;       /* Transport originated concealment. */
 
-    if (self == NULL) {
-      return AAC_DEC_INVALID_HANDLE;
-    }
     INT interleaved = self->outputInterleaved;
     INT_PCM *pTimeData = self->pcmOutputBuffer;
     INT timeDataSize = sizeof(self->pcmOutputBuffer)/sizeof(*self->pcmOutputBuffer);
@@ -843,6 +1020,16 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(
       }
     }
 
+    /* The configuration is up to date now: work in the client buffer if it is large enough. */
+    if (self->outputInPlace) {
+      INT workBufferSize = aacDecoder_GetWorkBufferSize(self);
+
+      if ( (workBufferSize > 0) && (timeDataSize_extern >= workBufferSize) ) {
+        pTimeData = pTimeData_extern;
+        timeDataSize = timeDataSize_extern;
+      }
+    }
+
     /* Signal bit stream interruption to other modules if required. */
     if ( fTpInterruption || (flags & (AACDEC_INTR|AACDEC_CLRHIST)) )
     {
@@ -903,7 +1090,37 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(
     }
     self->streamInfo.numChannels = self->streamInfo.aacNumChannels;
 
+    pState->outputValid = 1;
+    pState->ErrorStatus = ErrorStatus;
+    pState->pTimeData   = pTimeData;
+    pState->nBits       = nBits;
+    return;
 
+bail:
+    pState->outputValid = 0;
+    pState->ErrorStatus = ErrorStatus;
+    pState->pTimeData   = pTimeData;
+    pState->nBits       = nBits;
+}
+
+/*!
+  \brief Post processing stage of a frame: SBR, PCM post processing, limiter and output.
+*/
+static AAC_DECODER_ERROR aacDecoder_DecodeFramePost(
+        HANDLE_AACDECODER   self,
+        INT_PCM            *pTimeData_extern,
+        const INT           timeDataSize_extern,
+        const UINT          flags,
+        AACDEC_FRAME_STATE *pState)
+{
+    AAC_DECODER_ERROR ErrorStatus = pState->ErrorStatus;
+    INT interleaved = self->outputInterleaved;
+    INT_PCM *pTimeData = pState->pTimeData;
+    HANDLE_FDK_BITSTREAM hBs = transportDec_GetBitstream(self->hInput, 0);
+
+    if ( ! pState->outputValid ) {
+      goto bail;
+    }
 
     CAacDecoder_SyncQmfMode(self);
 
@@ -1023,6 +1240,7 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(
       setLimiterNChannels(self->hLimiter, self->streamInfo.numChannels);
       setLimiterSampleRate(self->hLimiter, self->streamInfo.sampleRate);
 
+      FDK_PROF_START(tLim);
       applyLimiter(
               self->hLimiter,
               pTimeData,
@@ -1032,6 +1250,7 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(
               self->extGainDelay,
               self->streamInfo.frameSize
               );
+      FDK_PROF_STOP(FDK_PROF_DEC_LIMITER, tLim);
 
       /* Announce the additional limiter output delay */
       self->streamInfo.outputDelay += getLimiterDelay(self->hLimiter);
@@ -1050,7 +1269,7 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(
 bail:
 
     /* Update Statistics */
-    aacDecoder_UpdateBitStreamCounters(&self->streamInfo, hBs, nBits, ErrorStatus);
+    aacDecoder_UpdateBitStreamCounters(&self->streamInfo, hBs, pState->nBits, ErrorStatus);
 
     /* Check whether external output buffer is large enough. */
     if (timeDataSize_extern < self->streamInfo.numChannels*self->streamInfo.frameSize) {
@@ -1059,7 +1278,13 @@ bail:
 
     /* Update external output buffer. */
     if ( IS_OUTPUT_VALID(ErrorStatus) ) {
-      FDKmemcpy(pTimeData_extern, pTimeData, self->streamInfo.numChannels*self->streamInfo.frameSize*sizeof(*pTimeData));
+      if (pTimeData != pTimeData_extern) {
+        FDKmemcpy(pTimeData_extern, pTimeData, self->streamInfo.numChannels*self->streamInfo.frameSize*sizeof(*pTimeData));
+      }
+    }
+    else if (pTimeData == pTimeData_extern) {
+      /* Only the announced output frame needs to be silenced. */
+      FDKmemclear(pTimeData_extern, fixMin(timeDataSize_extern, self->streamInfo.numChannels*self->streamInfo.frameSize)*sizeof(*pTimeData_extern));
     }
     else {
       FDKmemclear(pTimeData_extern, timeDataSize_extern*sizeof(*pTimeData_extern));
@@ -1068,11 +1293,160 @@ bail:
     return ErrorStatus;
 }
 
+static AAC_DECODER_ERROR aacDecoder_DecodeFrameInternal(
+        HANDLE_AACDECODER  self,
+        INT_PCM           *pTimeData_extern,
+        const INT          timeDataSize_extern,
+        const UINT         flags)
+{
+    AACDEC_FRAME_STATE state;
+
+    aacDecoder_DecodeFrameCore(self, pTimeData_extern, timeDataSize_extern, flags, &state);
+
+    return aacDecoder_DecodeFramePost(self, pTimeData_extern, timeDataSize_extern, flags, &state);
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(
+        HANDLE_AACDECODER  self,
+        INT_PCM           *pTimeData_extern,
+        const INT          timeDataSize_extern,
+        const UINT         flags)
+{
+    AAC_DECODER_ERROR ErrorStatus;
+    HANDLE_FDK_ARENA hPrevArena;
+#if defined(FDK_PROFILE)
+    FDK_PROF_STATS *pPrevProf;
+#endif
+
+    if (self == NULL) {
+      return AAC_DEC_INVALID_HANDLE;
+    }
+
+#if defined(FDK_PROFILE)
+    pPrevProf = FDKprofileBind(self->prof);
+#endif
+    /* Configuration changes signaled in-band allocate memory. */
+    hPrevArena = aacDecoder_EnterArena(self);
+    ErrorStatus = aacDecoder_DecodeFrameInternal(self, pTimeData_extern, timeDataSize_extern, flags);
+    FDKarenaBind(hPrevArena);
+#if defined(FDK_PROFILE)
+    FDKprofileBind(pPrevProf);
+#endif
+
+    return ErrorStatus;
+}
+
+#define AACDEC_BATCH_GROUP  ( 16 )  /* Number of instances moved through one stage before the next stage starts. */
+
+/* Order of decoder instances within a batch group: instances with equal configuration are adjacent. */
+static int aacDecoder_BatchCompare(const HANDLE_AACDECODER a, const HANDLE_AACDECODER b)
+{
+  if (a == NULL || b == NULL) {
+    return (a != NULL) - (b != NULL);
+  }
+  if (a->streamInfo.aot != b->streamInfo.aot) {
+    return (a->streamInfo.aot < b->streamInfo.aot) ? -1 : 1;
+  }
+  if (a->streamInfo.aacSampleRate != b->streamInfo.aacSampleRate) {
+    return (a->streamInfo.aacSampleRate < b->streamInfo.aacSampleRate) ? -1 : 1;
+  }
+  if (a->streamInfo.channelConfig != b->streamInfo.channelConfig) {
+    return (a->streamInfo.channelConfig < b->streamInfo.channelConfig) ? -1 : 1;
+  }
+  return (INT)a->sbrEnabled - (INT)b->sbrEnabled;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrameBatch(
+        AACDEC_BATCH_ITEM *pItems,
+        const UINT         numItems,
+        const UINT         flags)
+{
+    AACDEC_FRAME_STATE state[AACDEC_BATCH_GROUP];
+    UCHAR order[AACDEC_BATCH_GROUP];
+    AAC_DECODER_ERROR ErrorStatus = AAC_DEC_OK;
+    HANDLE_FDK_ARENA hPrevArena;
+#if defined(FDK_PROFILE)
+    FDK_PROF_STATS *pPrevProf;
+#endif
+    UINT first, n, i, j;
+
+    if (pItems == NULL) {
+      return AAC_DEC_INVALID_HANDLE;
+    }
+
+    for (first = 0; first < numItems; first += n)
+    {
+      n = fixMin(numItems - first, (UINT)AACDEC_BATCH_GROUP);
+
+      /* Sort the group by configuration (stable), so that tables and code of one configuration stay hot. */
+      for (i = 0; i < n; i++) {
+        UCHAR idx = (UCHAR)i;
+
+        for (j = i; (j > 0) && (aacDecoder_BatchCompare(pItems[first+order[j-1]].hDecoder, pItems[first+idx].hDecoder) > 0); j--) {
+          order[j] = order[j-1];
+        }
+        order[j] = idx;
+      }
+
+      /* Core stage of all instances of the group. */
+      for (i = 0; i < n; i++) {
+        AACDEC_BATCH_ITEM *pItem = &pItems[first+order[i]];
+        HANDLE_AACDECODER self = pItem->hDecoder;
+
+        if (self == NULL) {
+          continue;
+        }
+#if defined(FDK_PROFILE)
+        pPrevProf = FDKprofileBind(self->prof);
+#endif
+        hPrevArena = aacDecoder_EnterArena(self);
+        aacDecoder_DecodeFrameCore(self, pItem->pTimeData, pItem->timeDataSize, flags, &state[order[i]]);
+        FDKarenaBind(hPrevArena);
+#if defined(FDK_PROFILE)
+        FDKprofileBind(pPrevProf);
+#endif
+      }
+
+      /* Post processing stage of all instances of the group. */
+      for (i = 0; i < n; i++) {
+        AACDEC_BATCH_ITEM *pItem = &pItems[first+order[i]];
+        HANDLE_AACDECODER self = pItem->hDecoder;
+
+        if (self == NULL) {
+          pItem->err = AAC_DEC_INVALID_HANDLE;
+        }
+        else {
+#if defined(FDK_PROFILE)
+          pPrevProf = FDKprofileBind(self->prof);
+#endif
+          hPrevArena = aacDecoder_EnterArena(self);
+          pItem->err = aacDecoder_DecodeFramePost(self, pItem->pTimeData, pItem->timeDataSize, flags, &state[order[i]]);
+          FDKarenaBind(hPrevArena);
+#if defined(FDK_PROFILE)
+          FDKprofileBind(pPrevProf);
+#endif
+        }
+      }
+
+      for (i = 0; i < n; i++) {
+        if ( (ErrorStatus == AAC_DEC_OK) && (pItems[first+i].err != AAC_DEC_OK) ) {
+          ErrorStatus = pItems[first+i].err;
+        }
+      }
+    }
+
+    return ErrorStatus;
+}
+
 LINKSPEC_CPP void aacDecoder_Close ( HANDLE_AACDECODER self )
 {
+  HANDLE_FDK_ARENA hPrevArena;
+
   if (self == NULL)
     return;
 
+  hPrevArena = aacDecoder_EnterArena(self);
+
 
   if (self->hLimiter != NULL) {
     destroyLimiter(self->hLimiter);
@@ -1093,6 +1467,8 @@ LINKSPEC_CPP void aacDecoder_Close ( HANDLE_AACDECODER self )
   }
 
   CAacDecoder_Close(self);
+
+  FDKarenaBind(hPrevArena);
 }
 
 
@@ -515,6 +515,7 @@ AAC_DECODER_ERROR  CBlock_ReadSpectralData(HANDLE_FDK_BITSTREAM bs,
   FIXP_DBL locMax;
 
   int ScaleFactorBandsTransmitted = GetScaleFactorBandsTransmitted(&pAacDecoderChannelInfo->icsInfo);
+  FDK_PROF_START(tHuf);
 
   FDK_ASSERT(BandOffsets != NULL);
 
@@ -557,19 +558,27 @@ AAC_DECODER_ERROR  CBlock_ReadSpectralData(HANDLE_FDK_BITSTREAM bs,
 
             for (index=BandOffsets[band]; index < BandOffsets[band+1]; index+=step)
             {
-              int idx = CBlock_DecodeHuffmanWord(bs,hcb);
+              /* Table lookup as long as the look ahead stays within the bitstream, tree walk close to its end. */
+              if (bs->BitsInCache + bs->hBitBuf.ValidBits >= HuffmanLookupMaxBits)
+              {
+                CBlock_DecodeSpectralLookup(bs, hcb, &mdctSpectrum[index]);
+              }
+              else
+              {
+                int idx = CBlock_DecodeHuffmanWord(bs,hcb);
 
-              for (i=0; i<step; i++) {
-                FIXP_DBL tmp;
+                for (i=0; i<step; i++) {
+                  FIXP_DBL tmp;
 
-                tmp = (FIXP_DBL)((idx & mask)-offset);
-                idx >>= bits;
+                  tmp = (FIXP_DBL)((idx & mask)-offset);
+                  idx >>= bits;
 
-                if (offset == 0) {
-                  if (tmp != FIXP_DBL(0))
-                    tmp = (FDKreadBits(bs,1))? -tmp : tmp;
+                  if (offset == 0) {
+                    if (tmp != FIXP_DBL(0))
+                      tmp = (FDKreadBits(bs,1))? -tmp : tmp;
+                  }
+                  mdctSpectrum[index+i] = tmp;
                 }
-                mdctSpectrum[index+i] = tmp;
               }
 
               if (currentCB == ESCBOOK)
@@ -628,6 +637,7 @@ AAC_DECODER_ERROR  CBlock_ReadSpectralData(HANDLE_FDK_BITSTREAM bs,
                       SPEC_LONG(pSpectralCoefficient));
   }
 
+  FDK_PROF_STOP(FDK_PROF_DEC_HUFFMAN, tHuf);
 
   return AAC_DEC_OK;
 }
@@ -717,7 +727,7 @@ void CBlock_FrequencyToTime(CAacDecoderStaticChannelInfo *pAacDecoderStaticChann
     int i;
 
     {
-      FIXP_DBL *tmp = pAacDecoderChannelInfo->pComData->workBufferCore1->mdctOutTemp;
+      FIXP_DBL *tmp = pWorkBuffer1;
 
       nSamples = imdct_block(
              &pAacDecoderStaticChannelInfo->IMdct,
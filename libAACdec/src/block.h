@@ -202,6 +202,7 @@ void ApplyTools ( CAacDecoderChannelInfo *pAacDecoderChannelInfo[],
 
 /**
  * \brief Transform MDCT spectral data into time domain
+ * \param pWorkBuffer1 scratch memory of frameLen values for the transform output.
  */
 void CBlock_FrequencyToTime(CAacDecoderStaticChannelInfo *pAacDecoderStaticChannelInfo,
                             CAacDecoderChannelInfo *pAacDecoderChannelInfo,
@@ -317,6 +318,54 @@ inline int CBlock_DecodeHuffmanWord( HANDLE_FDK_BITSTREAM bs,
   return val;
 }
 
+/* Number of bits the lookup decoder may read ahead: root and second level table index. */
+#define HuffmanLookupMaxBits (2*HuffmanLookupBits)
+
+/*!
+  \brief Read spectral huffman codeword using the lookup table
+
+  The function resolves one codeword of a spectral codebook with at most two
+  table lookups instead of walking the 2 bit tree, and writes the Dimension
+  values of the codeword to pValue. Sign bits which fit into the same lookup
+  window are already applied by the table, the others are read here. Escape
+  sequences of codebook 11 are left to the caller.
+
+  The caller must ensure that at least HuffmanLookupMaxBits bits are left in
+  the bitstream, because unused look ahead bits are pushed back into the cache.
+*/
+inline void CBlock_DecodeSpectralLookup( HANDLE_FDK_BITSTREAM bs,                       /*!< pointer to bitstream */
+                                         const CodeBookDescription *hcb,                /*!< pointer to codebook description */
+                                         FIXP_DBL *pValue )                             /*!< pointer to decoded values */
+{
+  const UINT *lookup = hcb->LookupTable;
+  UINT val = lookup[FDKreadBits(bs,HuffmanLookupBits)];
+  int i;
+
+  if (val & HuffmanLookupSubTable)
+  {
+    UINT subBits = (val >> 16) & 0xF;
+
+    val = lookup[(val & 0xFFFF) + FDKreadBits(bs,subBits)];
+    FDKpushBackCache(bs, subBits - ((val >> 24) & 0x1F));
+  }
+  else
+  {
+    FDKpushBackCache(bs, HuffmanLookupBits - ((val >> 24) & 0x1F));
+  }
+
+  for (i=0; i<hcb->Dimension; i++) {
+    pValue[i] = (FIXP_DBL)(((INT)(val << (26-6*i))) >> 26);
+  }
+
+  if (val & HuffmanLookupSignBits)
+  {
+    for (i=0; i<hcb->Dimension; i++) {
+      if (pValue[i] != (FIXP_DBL)0)
+        pValue[i] = (FDKreadBits(bs,1))? -pValue[i] : pValue[i];
+    }
+  }
+}
+
 //#endif /* AACDEC_HUFFMANDECODER_ENABLE */
 
 #endif /* #ifndef BLOCK_H */
@@ -238,7 +238,9 @@ The input and output arguments of an aacEncEncode() call are described in argume
 The input buffer should be handled as a modulo buffer. New audio data in the form of pulse-code-
 modulated samples (PCM) must be read from external and be fed to the input buffer depending on its
 fill level. The required sample bitrate (represented by the data type INT_PCM which is 16, 24 or 32
-bits wide) is fixed and depends on library configuration (usually 16 bit).
+bits wide) is fixed and depends on library configuration (usually 16 bit, 32 bit if the library is
+configured with --with-pcm-bits=32). Input samples of different width are converted according to
+AACENC_BufDesc::bufElSizes.
 
 \dontinclude main.cpp
 \skipline WAV_InputRead
@@ -248,6 +250,62 @@ processed the new input data, update/move remaining samples in input buffer, sim
 \skipline outargs.numInSamples>0
 \until }
 
+\subsection feedInPlanar Planar Input
+If the audio samples are available per channel, ::AACENC_INPUT_LAYOUT can be set to planar input. In this
+case the input buffer descriptor holds one ::IN_AUDIO_DATA buffer per input channel. After each aacEncEncode()
+call, every channel buffer is advanced by AACENC_OutArgs::numInSamples divided by the number of input channels.
+
+\subsection feedInRing Ring Buffer Input
+Live capture applications may let the encoder read audio samples directly from a ring buffer owned by the
+application. The ring buffer is registered once with aacEncRegisterInputRing(). Afterwards the ::IN_AUDIO_DATA
+buffer descriptor is ignored and AACENC_InArgs::numInSamples announces the number of samples the application
+has newly written to the ring buffer. AACENC_OutArgs::numInSamples returns the number of samples the encoder
+has consumed; this part of the ring buffer may be overwritten again.\n
+The encoder never reads ahead of the frame it is encoding and does not keep references into the ring buffer
+after aacEncEncode() returned. Hence the ring buffer must hold at least one frame of audio samples, i.e. the
+input frame length times the number of input channels (see AACENC_InfoStruct::inputChannels and
+AACENC_InfoStruct::frameLength).\n
+If the ring buffer size is a multiple of one input frame and neither SBR nor meta data are active, the encoder
+reads each frame in place without copying it. In all other configurations the samples are copied into the
+internal input buffer as with the ::IN_AUDIO_DATA buffer.
+\code
+aacEncRegisterInputRing(hAacEncoder, ring, nFrames*frameLength*nChannels, 0);
+...
+inargs.numInSamples = nNewSamples;
+aacEncEncode(hAacEncoder, NULL, &outBufDesc, &inargs, &outargs);
+\endcode
+
+\section encSegments Segment-Parallel Encoding
+If the complete input signal is available in memory, e.g. for file transcoding, aacEncEncodeSegments() splits
+it into segments at chosen access unit boundaries and encodes the segments on separate encoder instances in
+parallel. Each segment encoder is primed with the input preceding the segment. The priming length is derived from
+the encoder delay (see AACENC_InfoStruct::encoderDelay), its access units are discarded. In constant bitrate mode
+the bit reservoir is handed off empty at each segment boundary: the last access unit of a segment spends all bits
+saved in the bit reservoir as fill bits, and the next segment starts with an empty bit reservoir. Hence the
+outputs of all segments simply concatenated in segment order form a valid bitstream.\n
+The first segment is identical to sequential encoding up to its last access unit. The result does not depend on
+the number of threads.
+\code
+AACENC_SEGMENT seg[2];
+seg[0].startFrame = 0;    seg[0].numFrames = 5000;  ... output buffers
+seg[1].startFrame = 5000; seg[1].numFrames = 0;     ... up to the end of the input
+aacEncEncodeSegments(hAacEncoder, pcm, nSamples*nChannels, seg, 2, 2);
+\endcode
+
+\section encClips Encoding Many Short Clips
+An encoder instance can be reused for a new stream without changing its configuration. Setting ::AACENC_CONTROL_STATE
+to ::AACENC_INIT_STATES | ::AACENC_INIT_TRANSPORT | ::AACENC_RESET_INBUFFER clears all signal history and pending
+input samples but keeps the allocated memory and the derived configuration. The following output is identical to the
+output of a newly opened encoder with the same parameters.\n
+aacEncEncodeClips() does so for a list of clips in memory: each clip is encoded and flushed in one call, the access
+units are written directly to the clip output buffers.
+\code
+AACENC_CLIP clip[2];
+clip[0].pInput = pcm0; clip[0].numInSamples = n0*nChannels; ... output buffers
+clip[1].pInput = pcm1; clip[1].numInSamples = n1*nChannels; ...
+aacEncEncodeClips(hAacEncoder, clip, 2);
+\endcode
+
 \section writeOutData Output Bitstream Data
 If any AAC bitstream data is available, write it to output file or device. This can be done once the
 following condition is true:
@@ -342,6 +400,29 @@ increase which might be significant. If workload is not an issue in the applicat
 we recommended to activate this feature.
 \code aacEncoder_SetParam(hAacEncoder, AACENC_AFTERBURNER, 1); \endcode
 
+For applications where throughput matters more than the last bit of audio quality, e.g. bulk
+transcoding, the encoder search effort can be reduced with ::AACENC_COMPLEXITY. The bitrate is
+not affected, only the way the available bits are spent.
+\code aacEncoder_SetParam(hAacEncoder, AACENC_COMPLEXITY, 2); \endcode
+
+In constant bitrate mode the bit reservoir can distribute the bits over several frames in advance if latency is
+not an issue, e.g. for file based encoding. With ::AACENC_LOOKAHEAD the encoder analyses up to 32 frames ahead and
+spends more bits on demanding passages while keeping the average bitrate. The input is delayed accordingly.
+\code aacEncoder_SetParam(hAacEncoder, AACENC_LOOKAHEAD, 16); \endcode
+
+For offline encoding the bit distribution can also be planned over the complete signal in two passes, see
+::AACENC_PASS. The first pass runs the psychoacoustic model only and returns one statistics record per frame
+instead of an access unit. The application stores the records of all frames, e.g. in a file. The second pass
+encodes the same input again and distributes the bits according to the registered statistics.
+\code
+aacEncoder_SetParam(hAacEncoder, AACENC_PASS, 1);
+... encode all input, append every AACENC_OutArgs::numOutBytes bytes of output to stats ...
+
+aacEncoder_SetParam(hAacEncoder, AACENC_PASS, 2);
+aacEncRegisterPassStats(hAacEncoder, stats, statsSize);
+... encode all input again ...
+\endcode
+
 \subsection encELD ELD Auto Configuration Mode
 For ELD configuration a so called auto configurator is available which configures SBR and the SBR ratio by itself.
 The configurator is used when the encoder parameter ::AACENC_SBR_MODE and ::AACENC_SBR_RATIO are not set explicitely.
@@ -739,7 +820,8 @@ typedef enum {
  */
 typedef enum {
     /* Input buffer identifier. */
-    IN_AUDIO_DATA      = 0,                  /*!< Audio input buffer, interleaved INT_PCM samples. */
+    IN_AUDIO_DATA      = 0,                  /*!< Audio input buffer, interleaved INT_PCM samples. With planar
+                                                  ::AACENC_INPUT_LAYOUT one buffer per input channel. */
     IN_ANCILLRY_DATA   = 1,                  /*!< Ancillary data to be embedded into bitstream. */
     IN_METADATA_SETUP  = 2,                  /*!< Setup structure for embedding meta data. */
 
@@ -778,7 +860,8 @@ typedef struct {
                                                   on audio object type configuration. */
 
     UINT                encoderDelay;        /*!< Codec delay in PCM samples/channel. Depends on framelength and AOT. Does not
-                                                  include framing delay for filling up encoder PCM input buffer. */
+                                                  include framing delay for filling up encoder PCM input buffer. Includes the
+                                                  look-ahead window, see ::AACENC_LOOKAHEAD. */
 
     UCHAR               confBuf[64];         /*!< Configuration buffer in binary format as an AudioSpecificConfig
                                                   or StreamMuxConfig according to the selected transport type. */
@@ -822,6 +905,47 @@ typedef struct {
 } AACENC_OutArgs;
 
 
+/**
+ *  Describes one segment of an aacEncEncodeSegments() call.
+ */
+typedef struct {
+    UINT                startFrame;          /*!< First access unit of the segment, counted in input frames of
+                                                  AACENC_InfoStruct::frameLength samples per channel. */
+    UINT                numFrames;           /*!< Number of access units of the segment, not 0. Must be 0 for the last
+                                                  segment, which always runs up to the end of the input including the
+                                                  access units flushed at the end. */
+    UCHAR              *pOutBuf;             /*!< Output buffer for the access units of this segment. Holds at most
+                                                  AACENC_InfoStruct::maxOutBufBytes bytes per access unit. */
+    UINT                outBufSize;          /*!< Size of pOutBuf in bytes. */
+    UINT               *pAuSizes;            /*!< Returns the size of each access unit in bytes, may be NULL. */
+    UINT                maxAus;              /*!< Number of entries of pAuSizes. */
+
+    UINT                numOutBytes;         /*!< Returns the number of bytes written to pOutBuf. */
+    UINT                numAus;              /*!< Returns the number of access units written to pOutBuf. */
+    AACENC_ERROR        err;                 /*!< Returns the result of this segment. */
+
+} AACENC_SEGMENT;
+
+
+/**
+ *  Describes one clip of an aacEncEncodeClips() call.
+ */
+typedef struct {
+    const INT_PCM      *pInput;              /*!< Interleaved input signal of the clip. */
+    UINT                numInSamples;        /*!< Number of input samples of all channels, multiple of the input
+                                                  channels. */
+    UCHAR              *pOutBuf;             /*!< Output buffer for the access units of this clip. */
+    UINT                outBufSize;          /*!< Size of pOutBuf in bytes. */
+    UINT               *pAuSizes;            /*!< Returns the size of each access unit in bytes, may be NULL. */
+    UINT                maxAus;              /*!< Number of entries of pAuSizes. */
+
+    UINT                numOutBytes;         /*!< Returns the number of bytes written to pOutBuf. */
+    UINT                numAus;              /*!< Returns the number of access units written to pOutBuf. */
+    AACENC_ERROR        err;                 /*!< Returns the result of this clip. */
+
+} AACENC_CLIP;
+
+
 /**
  *  Meta Data Compression Profiles.
  */
@@ -942,6 +1066,14 @@ typedef enum
                                                    - 1: Downsampled SBR (default for ELD).
                                                    - 2: Dual-rate SBR   (default for HE-AAC). */
 
+  AACENC_INPUT_LAYOUT             = 0x0109,  /*!< Layout of the ::IN_AUDIO_DATA input samples:
+                                                  - 0: Interleaved. One ::IN_AUDIO_DATA buffer holds the samples of all channels. (default)
+                                                  - 1: Planar. One ::IN_AUDIO_DATA buffer per input channel, given in channel order.
+                                                    AACENC_InArgs::numInSamples and AACENC_OutArgs::numInSamples count the samples
+                                                    of all channels and should be a multiple of the number of input channels. If at
+                                                    least one frame is available and neither SBR nor meta data are active, the core
+                                                    encoder reads the channel buffers in place. */
+
   AACENC_AFTERBURNER              = 0x0200,  /*!< This parameter controls the use of the afterburner feature.
                                                   The afterburner is a type of analysis by synthesis algorithm which increases the
                                                   audio quality but also the required processing power. It is recommended to always
@@ -952,11 +1084,40 @@ typedef enum
                                                   - 0: Disable afterburner (default).
                                                   - 1: Enable afterburner. */
 
+  AACENC_COMPLEXITY               = 0x0201,  /*!< Encoder speed preset. Lower search effort of the core encoder trades audio quality
+                                                  for throughput:
+                                                  - 0: Full search. (default)
+                                                  - 1: Fast. The afterburner refines scalefactors of single bands only and does not
+                                                       assimilate scalefactors over several bands.
+                                                  - 2: Fastest. No afterburner even if ::AACENC_AFTERBURNER is set, sections are
+                                                       merged in a single pass, TNS uses one filter of reduced order. */
+
+  AACENC_LOOKAHEAD                = 0x0202,  /*!< Look-ahead window in frames for the bit distribution in constant bitrate mode.
+                                                  The psychoacoustic model analyses the input this number of frames ahead of the
+                                                  encoded frame. The bit reservoir control then spends bits in proportion to the
+                                                  perceptual entropy of the frame relative to the whole window instead of reacting
+                                                  to past frames only. The input is delayed by the window, see
+                                                  AACENC_InfoStruct::encoderDelay. Without effect in variable bitrate modes and if
+                                                  SBR is active.
+                                                  - 0: Disabled (default).
+                                                  - 1 to 32: Look-ahead window in frames, 8 to 32 recommended. */
+
   AACENC_BANDWIDTH                = 0x0203,  /*!< Core encoder audio bandwidth:
                                                   - 0: Determine bandwidth internally (default, see chapter \ref BEHAVIOUR_BANDWIDTH).
                                                   - 1 to fs/2: Frequency bandwidth in Hertz. (Experts only, better do not
                                                                touch this value to avoid degraded audio quality) */
 
+  AACENC_PASS                     = 0x0204,  /*!< Two-pass encoding, see \ref encQual. Both passes need the same configuration and
+                                                  the same input signal including the end of input signaling.
+                                                  - 0: Single pass encoding (default).
+                                                  - 1: First pass. Only the psychoacoustic model runs. Instead of an access unit
+                                                       the output bitstream buffer receives the statistics record of the frame,
+                                                       two bytes per channel element.
+                                                  - 2: Second pass. The bit reservoir control distributes the bits over the
+                                                       frames according to the statistics registered with aacEncRegisterPassStats().
+                                                       Without effect in variable bitrate modes.
+                                                  ::AACENC_LOOKAHEAD is ignored in both passes. */
+
   AACENC_PEAK_BITRATE             = 0x0207,  /*!< Peak bitrate configuration parameter to adjust maximum bits per audio frame. Bitrate is in bits/second. 
                                                   The peak bitrate will internally be limited to the chosen bitrate ::AACENC_BITRATE as lower limit
                                                   and the number_of_effective_channels*6144 bit as upper limit.
@@ -1051,6 +1212,15 @@ typedef enum
                                                   - 1: Embed MPEG defined metadata only.
                                                   - 2: Embed all metadata. */
 
+  AACENC_NUM_THREADS              = 0x0700,  /*!< Number of threads used to process the channel elements (SCE, CPE, LFE) of one frame
+                                                  in parallel. Psychoacoustics, TNS, M/S and scalefactor estimation run element-wise
+                                                  on a worker pool; bit distribution and bitstream writing remain sequential. The
+                                                  encoded bitstream is identical to single-threaded operation.
+                                                  - 0, 1: Single-threaded. (default)
+                                                  - 2 ... 8: Number of threads including the calling thread. The number of threads
+                                                    is limited to the number of channel elements. Use aacEncoder_GetParam() to obtain
+                                                    the number of threads in use. */
+
   AACENC_CONTROL_STATE            = 0xFF00,  /*!< There is an automatic process which internally reconfigures the encoder instance
                                                   when a configuration parameter changed or an error occured. This paramerter allows
                                                   overwriting or getting the control status of this process. See ::AACENC_CTRLFLAGS. */
@@ -1094,6 +1264,50 @@ AACENC_ERROR aacEncOpen(
         const UINT                maxChannels
         );
 
+/**
+ * \brief  Get the memory requirements of an encoder instance per memory section.
+ *
+ * An encoder instance is opened with the given parameters and closed again to determine the amount of
+ * memory allocated by aacEncOpen(). Persistent memory holds the encoder state, scratch memory only holds
+ * data needed within one aacEncEncode() call. Memory of additional workers enabled with ::AACENC_NUM_THREADS
+ * is not included.
+ *
+ * \param encModules   Encoder modules to be supported, see aacEncOpen().
+ * \param maxChannels  Number of channels to be allocated, see aacEncOpen().
+ * \param pMemInfo     Pointer to a structure receiving the byte counts.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_INVALID_HANDLE, AACENC_MEMORY_ERROR, AACENC_INVALID_CONFIG, on failure.
+ */
+AACENC_ERROR aacEncoder_GetMemRequirements(
+        const UINT                encModules,
+        const UINT                maxChannels,
+        FDK_MEM_INFO             *pMemInfo
+        );
+
+/**
+ * \brief  Get the processing time statistics of an encoder instance.
+ *
+ * Reports the time spent in the psychoacoustic model, TNS, quantization, bitstream writing, SBR encoding and
+ * transport frame writing, accumulated over all aacEncEncode() calls since aacEncOpen(), in nanoseconds
+ * together with the number of calls per stage. Work of the workers enabled with ::AACENC_NUM_THREADS and of
+ * aacEncEncodeSegments() is included. The statistics are only collected if the library is configured with
+ * --enable-profiling, i.e. built with FDK_PROFILE defined.
+ *
+ * \param hAacEncoder  Encoder handle.
+ * \param pStats       Pointer to a structure receiving the statistics, cleared if not available.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_INVALID_HANDLE, on invalid arguments.
+ *          - AACENC_UNSUPPORTED_PARAMETER, if the library is built without profiling.
+ */
+AACENC_ERROR aacEncoder_GetStats(
+        const HANDLE_AACENCODER   hAacEncoder,
+        FDK_PROF_STATS           *pStats
+        );
+
 
 /**
  * \brief  Close the encoder instance.
@@ -1155,6 +1369,109 @@ AACENC_ERROR aacEncEncode(
         );
 
 
+/**
+ * \brief  Register a client-owned ring buffer as audio input. See \ref feedInRing.
+ *
+ * \param hAacEncoder           A valid AAC encoder handle.
+ * \param pRingBuffer           Ring buffer holding the input samples. NULL unregisters the ring buffer
+ *                              and returns to ::IN_AUDIO_DATA buffer input.
+ * \param ringSize              Size of the ring buffer in samples of all channels. Must be a multiple of
+ *                              the number of input channels.
+ * \param layout                Sample arrangement within the ring buffer:
+ *                              - 0: Interleaved. The samples of one time slot follow each other.
+ *                              - 1: Planar. Each channel occupies ringSize/channels consecutive samples.
+ *
+ * Registration resets the ring buffer read position to the beginning of the buffer.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_INVALID_HANDLE, AACENC_INVALID_CONFIG, on failure.
+ */
+AACENC_ERROR aacEncRegisterInputRing(
+        const HANDLE_AACENCODER   hAacEncoder,
+        INT_PCM                  *pRingBuffer,
+        const UINT                ringSize,
+        const UINT                layout
+        );
+
+
+/**
+ * \brief  Register the first pass statistics for the second pass of two-pass encoding. See ::AACENC_PASS.
+ *
+ * \param hAacEncoder           A valid AAC encoder handle.
+ * \param pStats                Statistics records of all frames of the first pass in output order. The memory
+ *                              must remain valid while the second pass is encoded. NULL unregisters the statistics.
+ * \param statsSize             Size of the statistics in bytes.
+ *
+ * Registration restarts the second pass at the first frame and resets the encoder states. If the statistics
+ * do not match the encoder configuration, the next aacEncEncode() call fails with AACENC_INIT_AAC_ERROR.
+ * Frames beyond the registered statistics are encoded as in single pass mode.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_INVALID_HANDLE, AACENC_INVALID_CONFIG, on failure.
+ */
+AACENC_ERROR aacEncRegisterPassStats(
+        const HANDLE_AACENCODER   hAacEncoder,
+        const UCHAR              *pStats,
+        const UINT                statsSize
+        );
+
+
+/**
+ * \brief  Encode a complete input signal in independent segments in parallel. See \ref encSegments.
+ *
+ * Each segment is encoded on an own encoder instance with the parameter set of hAacEncoder. The instances
+ * do not use element-parallel processing (::AACENC_NUM_THREADS). hAacEncoder itself is not modified and
+ * must have been initialized before. Meta data, ancillary data and two-pass encoding are not supported.
+ *
+ * \param hAacEncoder           A valid and initialized AAC encoder handle, used as configuration template.
+ * \param pInput                Complete interleaved input signal.
+ * \param numInSamples          Number of input samples of all channels, multiple of the input channels.
+ * \param pSegments             Segments in ascending order. Each segment starts where the previous one
+ *                              ends. The first segment must start at frame 0. The last segment runs up to
+ *                              the end of the input, its AACENC_SEGMENT::numFrames must be 0.
+ * \param numSegments           Number of segments.
+ * \param numThreads            Number of threads including the calling thread, limited to FDK_MAX_WORKERS.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_INVALID_HANDLE, AACENC_INVALID_CONFIG, on invalid arguments.
+ *          - The first error of any segment, see AACENC_SEGMENT::err.
+ */
+AACENC_ERROR aacEncEncodeSegments(
+        const HANDLE_AACENCODER   hAacEncoder,
+        const INT_PCM            *pInput,
+        const UINT                numInSamples,
+        AACENC_SEGMENT           *pSegments,
+        const UINT                numSegments,
+        const UINT                numThreads
+        );
+
+
+/**
+ * \brief  Encode a list of independent clips one after another on the given encoder instance. See \ref encClips.
+ *
+ * Before each clip the encoder is reset to a new stream as with ::AACENC_INIT_STATES, ::AACENC_INIT_TRANSPORT and
+ * ::AACENC_RESET_INBUFFER. Each clip is flushed completely. A registered input ring buffer, planar input and
+ * two-pass encoding are not supported.
+ *
+ * \param hAacEncoder           A valid AAC encoder handle.
+ * \param pClips                Clips to be encoded.
+ * \param numClips              Number of clips.
+ *
+ * \return
+ *          - AACENC_OK, on success.
+ *          - AACENC_INVALID_HANDLE, AACENC_INVALID_CONFIG, on invalid arguments.
+ *          - The first error of any clip, see AACENC_CLIP::err.
+ */
+AACENC_ERROR aacEncEncodeClips(
+        const HANDLE_AACENCODER   hAacEncoder,
+        AACENC_CLIP              *pClips,
+        const UINT                numClips
+        );
+
+
 /**
  * \brief  Acquire info about present encoder instance.
  *
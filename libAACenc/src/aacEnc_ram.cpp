@@ -95,7 +95,7 @@ amm-info@iis.fraunhofer.de
 
 #include "aacEnc_ram.h"
 
-  C_AALLOC_MEM (AACdynamic_RAM, FIXP_DBL, AAC_ENC_DYN_RAM_SIZE/sizeof(FIXP_DBL))
+  C_AALLOC_MEM_SCRATCH (AACdynamic_RAM, FIXP_DBL, AAC_ENC_DYN_RAM_SIZE/sizeof(FIXP_DBL))
 
 /*
   Static memory areas, must not be overwritten in other sections of the decoder !
@@ -131,6 +131,12 @@ C_ALLOC_MEM2 (Ram_aacEnc_PsyInputBuffer, INT_PCM, MAX_INPUT_BUFFER_SIZE, (8))
       return ((PSY_DYNAMIC*) (dynamic_RAM + P_BUF_1 + n*sizeof(PSY_DYNAMIC)));
   }
 
+/*
+   Additional workers of the element-parallel psych need private scratch memory.
+   Worker 0 uses the PSY_DYNAMIC located in dynamic_RAM.
+*/
+C_ALLOC_MEM2_SCRATCH (Ram_aacEnc_PsyDynamicWorker, PSY_DYNAMIC, 1, FDK_MAX_WORKERS)
+
   C_ALLOC_MEM (Ram_bsOutbuffer, UCHAR, OUTPUTBUFFER_SIZE)
 
 /*
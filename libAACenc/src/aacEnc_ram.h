@@ -106,6 +106,7 @@ amm-info@iis.fraunhofer.de
 #include "bitenc.h"
 #include "bit_cnt.h"
 #include "psy_const.h"
+#include "FDK_thread.h"
 
   #define  OUTPUTBUFFER_SIZE    (8192)  /*!< Output buffer size has to be at least 6144 bits per channel (768 bytes). FDK bitbuffer implementation expects buffer of size 2^n. */
 
@@ -144,6 +145,21 @@ struct AAC_ENC {
 
   FIXP_DBL  *dynamic_RAM;
 
+  HANDLE_FDK_WORKERPOOL hWorkerPool;              /* element-parallel processing, NULL if single-threaded */
+  PSY_DYNAMIC          *psyDynamic[FDK_MAX_WORKERS]; /* psych scratch memory of each worker */
+
+  PSY_INTERNAL     *psyKernelLookAhead;               /* psych running ahead by the look-ahead window, NULL if disabled */
+  ATS_ELEMENT      *adjThrStateLookAhead[(8)];        /* pe calculation states of the look-ahead psych */
+  INT               lookAhead;                        /* look-ahead window in frames */
+  INT               lookAheadPos;                     /* ring position for the pe of the next analysed frame */
+  INT               lookAheadPe[AACENC_MAX_LOOKAHEAD+1][(8)]; /* pe of each frame within the look-ahead window per element */
+
+  const UCHAR      *pPassStats;                       /* first pass statistics of two-pass encoding, NULL if single pass */
+  INT               passFrames;                       /* number of frames covered by the statistics */
+  INT               passFrame;                        /* index of the next frame of the second pass */
+  INT               passMeanPe[(8)];                  /* mean pe over all frames per element */
+  INT              *pPassNeed;                        /* planned bitreservoir fill before each frame per element, NULL if not yet planned */
+
 
   INT maxChannels;           /* used while allocation */
   INT maxElements;
@@ -200,6 +216,7 @@ END - Dynamic RAM - Allocation */
   H_ALLOC_MEM (Ram_aacEnc_PsyInputBuffer, INT_PCM)
 
   PSY_DYNAMIC *GetRam_aacEnc_PsyDynamic (int n, UCHAR* dynamic_RAM);
+  H_ALLOC_MEM (Ram_aacEnc_PsyDynamicWorker, PSY_DYNAMIC)
   H_ALLOC_MEM (Ram_bsOutbuffer, UCHAR)
 
   H_ALLOC_MEM (Ram_aacEnc_PsyOutChannel, PSY_OUT_CHANNEL)
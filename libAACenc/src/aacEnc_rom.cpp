@@ -195,6 +195,98 @@ const UCHAR FDKaacEnc_huff_ltab11[17][17]=
   {0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x05}
 };
 
+/* Code lengths of pairs of absolute values (0..16, 16 is the escape of codebook 11) for the
+   codebooks 7, 8, 9, 10 and 11 including the sign bits, see HUFF_LTAB_PACK. Lengths of codebooks
+   that cannot code a pair are 0. */
+const UINT64 FDKaacEnc_huff_ltab7_11[17][17]=
+{
+  {HUFF_LTAB_PACK( 1, 5, 1, 6, 4), HUFF_LTAB_PACK( 4, 5, 4, 6, 6), HUFF_LTAB_PACK( 7, 6, 7, 7, 7), HUFF_LTAB_PACK( 8, 7, 9, 7, 8),
+    HUFF_LTAB_PACK( 9, 8,10, 8, 9), HUFF_LTAB_PACK(10, 9,11, 9, 9), HUFF_LTAB_PACK(11,10,11,10,10), HUFF_LTAB_PACK(12,11,12,11,11),
+    HUFF_LTAB_PACK( 0, 0,12,11,11), HUFF_LTAB_PACK( 0, 0,13,11,11), HUFF_LTAB_PACK( 0, 0,13,12,12), HUFF_LTAB_PACK( 0, 0,14,12,12),
+    HUFF_LTAB_PACK( 0, 0,14,13,13), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,11)},
+  {HUFF_LTAB_PACK( 4, 5, 4, 6, 6), HUFF_LTAB_PACK( 6, 5, 6, 6, 6), HUFF_LTAB_PACK( 8, 6, 8, 6, 7), HUFF_LTAB_PACK( 9, 7, 9, 7, 8),
+    HUFF_LTAB_PACK(10, 8,10, 8, 9), HUFF_LTAB_PACK(10, 9,10, 9, 9), HUFF_LTAB_PACK(11, 9,11, 9,10), HUFF_LTAB_PACK(11,10,12,10,10),
+    HUFF_LTAB_PACK( 0, 0,12,10,11), HUFF_LTAB_PACK( 0, 0,12,11,11), HUFF_LTAB_PACK( 0, 0,13,12,11), HUFF_LTAB_PACK( 0, 0,14,12,12),
+    HUFF_LTAB_PACK( 0, 0,14,13,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,13),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,10)},
+  {HUFF_LTAB_PACK( 7, 6, 7, 7, 7), HUFF_LTAB_PACK( 8, 6, 8, 6, 7), HUFF_LTAB_PACK( 9, 6, 9, 7, 7), HUFF_LTAB_PACK(10, 7,10, 7, 8),
+    HUFF_LTAB_PACK(10, 8,10, 8, 9), HUFF_LTAB_PACK(11, 9,11, 8, 9), HUFF_LTAB_PACK(11, 9,12, 9,10), HUFF_LTAB_PACK(12,10,12,10,10),
+    HUFF_LTAB_PACK( 0, 0,12,10,10), HUFF_LTAB_PACK( 0, 0,13,11,11), HUFF_LTAB_PACK( 0, 0,14,11,11), HUFF_LTAB_PACK( 0, 0,14,12,11),
+    HUFF_LTAB_PACK( 0, 0,14,12,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,10)},
+  {HUFF_LTAB_PACK( 8, 7, 9, 7, 8), HUFF_LTAB_PACK( 9, 7, 9, 7, 8), HUFF_LTAB_PACK(10, 7,10, 7, 8), HUFF_LTAB_PACK(10, 8,11, 7, 8),
+    HUFF_LTAB_PACK(11, 8,11, 8, 9), HUFF_LTAB_PACK(11, 9,12, 9, 9), HUFF_LTAB_PACK(12,10,12, 9,10), HUFF_LTAB_PACK(12,10,13,10,10),
+    HUFF_LTAB_PACK( 0, 0,13,10,10), HUFF_LTAB_PACK( 0, 0,13,11,11), HUFF_LTAB_PACK( 0, 0,14,11,11), HUFF_LTAB_PACK( 0, 0,14,12,11),
+    HUFF_LTAB_PACK( 0, 0,15,12,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,10)},
+  {HUFF_LTAB_PACK( 9, 8,10, 8, 9), HUFF_LTAB_PACK(10, 8,10, 8, 9), HUFF_LTAB_PACK(11, 8,11, 8, 9), HUFF_LTAB_PACK(11, 8,11, 8, 9),
+    HUFF_LTAB_PACK(12, 9,12, 8, 9), HUFF_LTAB_PACK(12, 9,12, 9,10), HUFF_LTAB_PACK(12,10,13, 9,10), HUFF_LTAB_PACK(13,11,13,10,10),
+    HUFF_LTAB_PACK( 0, 0,13,10,10), HUFF_LTAB_PACK( 0, 0,14,11,11), HUFF_LTAB_PACK( 0, 0,14,11,11), HUFF_LTAB_PACK( 0, 0,14,12,11),
+    HUFF_LTAB_PACK( 0, 0,15,12,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,10)},
+  {HUFF_LTAB_PACK(10, 9,11, 9, 9), HUFF_LTAB_PACK(10, 9,11, 9, 9), HUFF_LTAB_PACK(11, 8,11, 8, 9), HUFF_LTAB_PACK(11, 9,12, 9, 9),
+    HUFF_LTAB_PACK(12, 9,13, 9, 9), HUFF_LTAB_PACK(12,10,13, 9,10), HUFF_LTAB_PACK(13,10,13,10,10), HUFF_LTAB_PACK(13,12,14,10,10),
+    HUFF_LTAB_PACK( 0, 0,13,10,11), HUFF_LTAB_PACK( 0, 0,14,11,11), HUFF_LTAB_PACK( 0, 0,14,12,11), HUFF_LTAB_PACK( 0, 0,15,12,11),
+    HUFF_LTAB_PACK( 0, 0,15,13,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,10)},
+  {HUFF_LTAB_PACK(11,10,12,10,10), HUFF_LTAB_PACK(11, 9,11, 9,10), HUFF_LTAB_PACK(11, 9,12, 9,10), HUFF_LTAB_PACK(12,10,13, 9,10),
+    HUFF_LTAB_PACK(12,10,13, 9,10), HUFF_LTAB_PACK(13,10,13,10,10), HUFF_LTAB_PACK(14,11,14,10,10), HUFF_LTAB_PACK(14,11,14,11,10),
+    HUFF_LTAB_PACK( 0, 0,14,11,11), HUFF_LTAB_PACK( 0, 0,14,11,11), HUFF_LTAB_PACK( 0, 0,15,12,11), HUFF_LTAB_PACK( 0, 0,15,12,12),
+    HUFF_LTAB_PACK( 0, 0,15,13,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,10)},
+  {HUFF_LTAB_PACK(12,11,12,10,10), HUFF_LTAB_PACK(12,10,12,10,10), HUFF_LTAB_PACK(12,10,12,10,10), HUFF_LTAB_PACK(12,10,13,10,10),
+    HUFF_LTAB_PACK(13,11,13,10,10), HUFF_LTAB_PACK(13,11,14,10,10), HUFF_LTAB_PACK(14,11,14,11,10), HUFF_LTAB_PACK(14,12,15,11,11),
+    HUFF_LTAB_PACK( 0, 0,15,11,11), HUFF_LTAB_PACK( 0, 0,15,12,11), HUFF_LTAB_PACK( 0, 0,15,12,12), HUFF_LTAB_PACK( 0, 0,15,13,12),
+    HUFF_LTAB_PACK( 0, 0,15,13,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,10)},
+  {HUFF_LTAB_PACK( 0, 0,12,10,11), HUFF_LTAB_PACK( 0, 0,12,10,11), HUFF_LTAB_PACK( 0, 0,12,10,10), HUFF_LTAB_PACK( 0, 0,13,10,10),
+    HUFF_LTAB_PACK( 0, 0,13,10,11), HUFF_LTAB_PACK( 0, 0,13,10,11), HUFF_LTAB_PACK( 0, 0,14,11,11), HUFF_LTAB_PACK( 0, 0,14,11,11),
+    HUFF_LTAB_PACK( 0, 0,15,12,11), HUFF_LTAB_PACK( 0, 0,15,12,12), HUFF_LTAB_PACK( 0, 0,16,12,12), HUFF_LTAB_PACK( 0, 0,15,13,12),
+    HUFF_LTAB_PACK( 0, 0,16,13,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,13),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,10)},
+  {HUFF_LTAB_PACK( 0, 0,12,11,11), HUFF_LTAB_PACK( 0, 0,12,11,11), HUFF_LTAB_PACK( 0, 0,13,11,11), HUFF_LTAB_PACK( 0, 0,13,11,11),
+    HUFF_LTAB_PACK( 0, 0,14,11,11), HUFF_LTAB_PACK( 0, 0,14,11,11), HUFF_LTAB_PACK( 0, 0,14,11,11), HUFF_LTAB_PACK( 0, 0,14,12,11),
+    HUFF_LTAB_PACK( 0, 0,15,12,12), HUFF_LTAB_PACK( 0, 0,15,12,12), HUFF_LTAB_PACK( 0, 0,16,13,12), HUFF_LTAB_PACK( 0, 0,16,13,12),
+    HUFF_LTAB_PACK( 0, 0,16,14,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,10)},
+  {HUFF_LTAB_PACK( 0, 0,13,11,12), HUFF_LTAB_PACK( 0, 0,13,11,11), HUFF_LTAB_PACK( 0, 0,13,11,11), HUFF_LTAB_PACK( 0, 0,14,11,11),
+    HUFF_LTAB_PACK( 0, 0,14,11,11), HUFF_LTAB_PACK( 0, 0,14,12,11), HUFF_LTAB_PACK( 0, 0,15,12,11), HUFF_LTAB_PACK( 0, 0,15,12,12),
+    HUFF_LTAB_PACK( 0, 0,15,12,12), HUFF_LTAB_PACK( 0, 0,16,13,12), HUFF_LTAB_PACK( 0, 0,16,13,12), HUFF_LTAB_PACK( 0, 0,16,13,12),
+    HUFF_LTAB_PACK( 0, 0,17,14,13), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,10)},
+  {HUFF_LTAB_PACK( 0, 0,13,12,12), HUFF_LTAB_PACK( 0, 0,13,12,12), HUFF_LTAB_PACK( 0, 0,14,11,11), HUFF_LTAB_PACK( 0, 0,14,12,11),
+    HUFF_LTAB_PACK( 0, 0,14,12,12), HUFF_LTAB_PACK( 0, 0,15,12,11), HUFF_LTAB_PACK( 0, 0,15,12,12), HUFF_LTAB_PACK( 0, 0,15,12,12),
+    HUFF_LTAB_PACK( 0, 0,15,13,12), HUFF_LTAB_PACK( 0, 0,16,13,12), HUFF_LTAB_PACK( 0, 0,16,13,12), HUFF_LTAB_PACK( 0, 0,17,13,13),
+    HUFF_LTAB_PACK( 0, 0,17,14,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,10)},
+  {HUFF_LTAB_PACK( 0, 0,14,12,12), HUFF_LTAB_PACK( 0, 0,14,12,12), HUFF_LTAB_PACK( 0, 0,14,12,12), HUFF_LTAB_PACK( 0, 0,14,12,12),
+    HUFF_LTAB_PACK( 0, 0,15,12,12), HUFF_LTAB_PACK( 0, 0,15,12,12), HUFF_LTAB_PACK( 0, 0,15,12,12), HUFF_LTAB_PACK( 0, 0,15,13,12),
+    HUFF_LTAB_PACK( 0, 0,16,13,12), HUFF_LTAB_PACK( 0, 0,16,14,12), HUFF_LTAB_PACK( 0, 0,16,14,12), HUFF_LTAB_PACK( 0, 0,16,14,13),
+    HUFF_LTAB_PACK( 0, 0,17,14,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,11)},
+  {HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,11), HUFF_LTAB_PACK( 0, 0, 0, 0,11),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,11)},
+  {HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,11)},
+  {HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12), HUFF_LTAB_PACK( 0, 0, 0, 0,12),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,13), HUFF_LTAB_PACK( 0, 0, 0, 0,14), HUFF_LTAB_PACK( 0, 0, 0, 0,14),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,11)},
+  {HUFF_LTAB_PACK( 0, 0, 0, 0,10), HUFF_LTAB_PACK( 0, 0, 0, 0,10), HUFF_LTAB_PACK( 0, 0, 0, 0,10), HUFF_LTAB_PACK( 0, 0, 0, 0,10),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,10), HUFF_LTAB_PACK( 0, 0, 0, 0,10), HUFF_LTAB_PACK( 0, 0, 0, 0,10), HUFF_LTAB_PACK( 0, 0, 0, 0,10),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,10), HUFF_LTAB_PACK( 0, 0, 0, 0,10), HUFF_LTAB_PACK( 0, 0, 0, 0,10), HUFF_LTAB_PACK( 0, 0, 0, 0,10),
+    HUFF_LTAB_PACK( 0, 0, 0, 0,10), HUFF_LTAB_PACK( 0, 0, 0, 0,10), HUFF_LTAB_PACK( 0, 0, 0, 0,10), HUFF_LTAB_PACK( 0, 0, 0, 0,11),
+    HUFF_LTAB_PACK( 0, 0, 0, 0, 7)}
+};
+
 const UCHAR FDKaacEnc_huff_ltabscf[121]=
 {
   0x12, 0x12, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
@@ -111,6 +111,14 @@ extern const ULONG  FDKaacEnc_huff_ltab5_6[9][9];
 extern const ULONG  FDKaacEnc_huff_ltab7_8[8][8];
 extern const ULONG  FDKaacEnc_huff_ltab9_10[13][13];
 extern const UCHAR  FDKaacEnc_huff_ltab11[17][17];
+
+/* Code lengths of the codebooks 7 to 11 packed into 12 bit fields of one word. Sums of up to
+   HUFF_LTAB_PACK_LINES lines can be accumulated in the packed format without overflow. */
+#define HUFF_LTAB_PACK(cb7,cb8,cb9,cb10,cb11) \
+  ( ((UINT64)(cb7)<<48) | ((UINT64)(cb8)<<36) | ((UINT64)(cb9)<<24) | ((UINT64)(cb10)<<12) | (UINT64)(cb11) )
+#define HUFF_LTAB_UNPACK(packed,cb)  ( (INT)((packed) >> (12*(11-(cb)))) & 0xfff )
+#define HUFF_LTAB_PACK_LINES  ( 256 )
+extern const UINT64 FDKaacEnc_huff_ltab7_11[17][17];
 extern const UCHAR  FDKaacEnc_huff_ltabscf[121];
 extern const USHORT FDKaacEnc_huff_ctab1[3][3][3][3];
 extern const USHORT FDKaacEnc_huff_ctab2[3][3][3][3];
@@ -291,6 +291,32 @@ static INT FDKaacEnc_EncBitresToTpBitres(
   return transporBitreservoir;
 }
 
+/*-----------------------------------------------------------------------------
+
+     functionname: FDKaacEnc_BitResHandoff
+     description:  hand off the bit reservoir at a segment boundary
+     returns:      ---
+
+ ------------------------------------------------------------------------------*/
+void FDKaacEnc_BitResHandoff(HANDLE_AAC_ENC hAacEnc, BITRES_HANDOFF handoff)
+{
+  if (hAacEnc->bitrateMode != AACENC_BR_MODE_CBR) {
+    return;
+  }
+
+  switch (handoff) {
+    case BITRES_HANDOFF_START:
+      hAacEnc->qcKernel->bitResTot   = 0;
+      hAacEnc->qcKernel->bitResDrain = 0;
+      break;
+    case BITRES_HANDOFF_END:
+      hAacEnc->qcKernel->bitResDrain = 1;
+      break;
+    default:
+      hAacEnc->qcKernel->bitResDrain = 0;
+  }
+}
+
 /*-----------------------------------------------------------------------------
 
      functionname: FDKaacEnc_AacInitDefaultConfig
@@ -325,6 +351,9 @@ void FDKaacEnc_AacInitDefaultConfig(AACENC_CONFIG *config)
     config->maxBitsPerFrame = -1;                   /* minum number of bits in each AU */
     config->bitreservoir    = -1;                   /* default, uninitialized value */
     config->audioMuxVersion = -1;                   /* audio mux version not configured */
+    config->nThreads        = 1;                    /* single-threaded */
+    config->complexity      = ENC_COMPLEXITY_FULL;  /* full search */
+    config->lookAhead       = 0;                    /* no look-ahead */
 
     /* init tabs in fixpoint_math */
     InitLdInt();
@@ -332,6 +361,137 @@ void FDKaacEnc_AacInitDefaultConfig(AACENC_CONFIG *config)
 }
 
 
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_InitWorkers
+    description:  (re)create worker pool and psych scratch memory for
+                  element-parallel processing
+    returns:      error code
+
+  ---------------------------------------------------------------------------*/
+static AAC_ENCODER_ERROR FDKaacEnc_InitWorkers(HANDLE_AAC_ENC hAacEnc,
+                                               AACENC_CONFIG *config)
+{
+  INT n, nWorkers;
+
+  /* more workers than channel elements would idle */
+  nWorkers = fixMax(1, fixMin(config->nThreads, hAacEnc->channelMapping.nElements));
+  nWorkers = fixMin(nWorkers, FDK_MAX_WORKERS);
+
+  if (nWorkers != FDKworkerPoolGetWorkers(hAacEnc->hWorkerPool)) {
+    FDKworkerPoolClose(&hAacEnc->hWorkerPool);
+
+    if (FDKworkerPoolOpen(&hAacEnc->hWorkerPool, nWorkers) != 0) {
+      return AAC_ENC_NO_MEMORY;
+    }
+    nWorkers = FDKworkerPoolGetWorkers(hAacEnc->hWorkerPool);
+  }
+
+  hAacEnc->psyDynamic[0] = hAacEnc->psyKernel->psyDynamic;
+
+  for (n=1; n<FDK_MAX_WORKERS; n++) {
+    if ( (n < nWorkers) && (hAacEnc->psyDynamic[n] == NULL) ) {
+      hAacEnc->psyDynamic[n] = GetRam_aacEnc_PsyDynamicWorker(n);
+      if (hAacEnc->psyDynamic[n] == NULL) {
+        return AAC_ENC_NO_MEMORY;
+      }
+    }
+    if ( (n >= nWorkers) && (hAacEnc->psyDynamic[n] != NULL) ) {
+      FreeRam_aacEnc_PsyDynamicWorker(&hAacEnc->psyDynamic[n]);
+    }
+  }
+
+  hAacEnc->qcKernel->hWorkerPool = hAacEnc->hWorkerPool;
+
+  return AAC_ENC_OK;
+}
+
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_InitLookAhead
+    description:  (re)create the psych running ahead of the encoded frame;
+                  must be called after psych and quantizer initialization
+    returns:      error code
+
+  ---------------------------------------------------------------------------*/
+static AAC_ENCODER_ERROR FDKaacEnc_InitLookAhead(HANDLE_AAC_ENC  hAacEnc,
+                                                 AACENC_CONFIG  *config,
+                                                 INT             psyBitrate,
+                                                 INT             tnsMask,
+                                                 ULONG           initFlags)
+{
+  AAC_ENCODER_ERROR ErrorStatus;
+  CHANNEL_MAPPING *cm = &hAacEnc->channelMapping;
+  INT el;
+
+  if (config->lookAhead <= 0) {
+    FDKaacEnc_PsyClose(&hAacEnc->psyKernelLookAhead, NULL);
+    for (el=0; el<(8); el++) {
+      FreeRam_aacEnc_AdjThrStateElement(&hAacEnc->adjThrStateLookAhead[el]);
+    }
+    hAacEnc->lookAhead = 0;
+    return AAC_ENC_OK;
+  }
+
+  if (hAacEnc->psyKernelLookAhead == NULL) {
+    ErrorStatus = FDKaacEnc_PsyNew(&hAacEnc->psyKernelLookAhead,
+                                    hAacEnc->maxElements,
+                                    hAacEnc->maxChannels
+                                   ,(UCHAR*)hAacEnc->dynamic_RAM
+                                   );
+    if (ErrorStatus != AAC_ENC_OK)
+      return ErrorStatus;
+
+    initFlags = 1; /* new psych states */
+  }
+
+  for (el=0; el<hAacEnc->maxElements; el++) {
+    if (hAacEnc->adjThrStateLookAhead[el] == NULL) {
+      hAacEnc->adjThrStateLookAhead[el] = GetRam_aacEnc_AdjThrStateElement(el);
+      if (hAacEnc->adjThrStateLookAhead[el] == NULL) {
+        return AAC_ENC_NO_MEMORY;
+      }
+    }
+  }
+
+  ErrorStatus = FDKaacEnc_psyInit(hAacEnc->psyKernelLookAhead,
+                                  hAacEnc->psyOut,
+                                  hAacEnc->maxFrames,
+                                  hAacEnc->maxChannels,
+                                  config->audioObjectType,
+                                  cm);
+  if (ErrorStatus != AAC_ENC_OK)
+    return ErrorStatus;
+
+  ErrorStatus = FDKaacEnc_psyMainInit(hAacEnc->psyKernelLookAhead,
+                                      config->audioObjectType,
+                                      cm,
+                                      config->sampleRate,
+                                      config->framelength,
+                                      psyBitrate,
+                                      tnsMask,
+                                      hAacEnc->bandwidth90dB,
+                                      config->usePns,
+                                      config->useIS,
+                                      config->syntaxFlags,
+                                      initFlags);
+  if (ErrorStatus != AAC_ENC_OK)
+    return ErrorStatus;
+
+  /* same pe calculation parameters as the encoded frame */
+  for (el=0; el<cm->nElements; el++) {
+    FDKmemcpy(hAacEnc->adjThrStateLookAhead[el], hAacEnc->qcKernel->hAdjThr->adjThrStateElem[el], sizeof(ATS_ELEMENT));
+  }
+
+  if ( initFlags || (hAacEnc->lookAhead != config->lookAhead) ) {
+    FDKmemclear(hAacEnc->lookAheadPe, sizeof(hAacEnc->lookAheadPe));
+    hAacEnc->lookAheadPos = 0;
+  }
+  hAacEnc->lookAhead = config->lookAhead;
+
+  return AAC_ENC_OK;
+}
+
 /*---------------------------------------------------------------------------
 
     functionname: FDKaacEnc_Open
@@ -561,6 +721,9 @@ AAC_ENCODER_ERROR FDKaacEnc_Initialize(HANDLE_AAC_ENC      hAacEnc,
   hAacEnc->bandwidth90dB = (INT)hAacEnc->config->bandWidth;
 
   tnsMask = config->useTns ? TNS_ENABLE_MASK : 0x0;
+  if (config->complexity >= ENC_COMPLEXITY_FASTEST) {
+    tnsMask |= TNS_REDUCED_SEARCH_MASK;
+  }
   psyBitrate = config->bitRate - config->ancDataBitRate;
 
   ErrorStatus = FDKaacEnc_psyInit(hAacEnc->psyKernel,
@@ -665,7 +828,18 @@ AAC_ENCODER_ERROR FDKaacEnc_Initialize(HANDLE_AAC_ENC      hAacEnc,
     goto bail;
   }
 
-  qcInit.invQuant = (config->useRequant)?2:0;
+  /* afterburner levels: 1: improve single scalefactors, 2: assimilate single scalefactors, 3: assimilate several */
+  switch (config->complexity) {
+    case ENC_COMPLEXITY_FULL:
+      qcInit.invQuant = (config->useRequant)?3:0;
+      break;
+    case ENC_COMPLEXITY_FAST:
+      qcInit.invQuant = (config->useRequant)?2:0;
+      break;
+    default:
+      qcInit.invQuant = 0;
+  }
+  qcInit.fastSectioning = (config->complexity >= ENC_COMPLEXITY_FASTEST) ? 1 : 0;
 
   /* maxIterations should be set to the maximum number of requantization iterations that are
    * allowed before the crash recovery functionality is activated. This setting should be adjusted
@@ -690,6 +864,14 @@ AAC_ENCODER_ERROR FDKaacEnc_Initialize(HANDLE_AAC_ENC      hAacEnc,
   if (ErrorStatus != AAC_ENC_OK)
     goto bail;
 
+  ErrorStatus = FDKaacEnc_InitWorkers(hAacEnc, config);
+  if (ErrorStatus != AAC_ENC_OK)
+    goto bail;
+
+  ErrorStatus = FDKaacEnc_InitLookAhead(hAacEnc, config, psyBitrate, tnsMask, initFlags);
+  if (ErrorStatus != AAC_ENC_OK)
+    goto bail;
+
   hAacEnc->aot = hAacEnc->config->audioObjectType;
 
   /* common things */
@@ -702,6 +884,317 @@ bail:
 }
 
 
+/* Element-parallel part of FDKaacEnc_EncodeFrame(). */
+typedef struct {
+    HANDLE_AAC_ENC     hAacEnc;
+    PSY_INTERNAL      *psyKernel;                 /* psych of the encoded or the look-ahead frame */
+    ATS_ELEMENT      **adjThrStateElem;
+    const PCM_INPUT   *pInput;
+    PSY_OUT           *psyOut;
+    QC_OUT            *qcOut;
+    AAC_ENCODER_ERROR  errorStatus[(8)];
+} ENCODE_ELEMENT_JOB;
+
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_EncodeElementJob
+    description:  psychoacoustics (incl. TNS, M/S) and quantization preparation
+                  of one channel element; touches element private data and
+                  the psych scratch memory of the executing worker only
+    returns:      ---
+
+  ---------------------------------------------------------------------------*/
+static void FDKaacEnc_EncodeElementJob(void *pCtx, INT el, INT worker)
+{
+    ENCODE_ELEMENT_JOB *job     = (ENCODE_ELEMENT_JOB*)pCtx;
+    HANDLE_AAC_ENC      hAacEnc = job->hAacEnc;
+    PSY_INTERNAL       *hPsy    = job->psyKernel;
+    CHANNEL_MAPPING    *cm      = &hAacEnc->channelMapping;
+    PSY_OUT            *psyOut  = job->psyOut;
+    QC_OUT             *qcOut   = job->qcOut;
+    ELEMENT_INFO        elInfo  = cm->elInfo[el];
+
+    job->errorStatus[el] = AAC_ENC_OK;
+
+    if ( (elInfo.elType == ID_SCE)
+      || (elInfo.elType == ID_CPE)
+      || (elInfo.elType == ID_LFE) )
+    {
+        int ch;
+
+        /* update pointer!*/
+        for(ch=0;ch<elInfo.nChannelsInEl;ch++) {
+            PSY_OUT_CHANNEL *psyOutChan = psyOut->psyOutElement[el]->psyOutChannel[ch];
+            QC_OUT_CHANNEL  *qcOutChan = qcOut->qcElement[el]->qcOutChannel[ch];
+
+            psyOutChan->mdctSpectrum       = qcOutChan->mdctSpectrum;
+            psyOutChan->sfbSpreadEnergy  = qcOutChan->sfbSpreadEnergy;
+            psyOutChan->sfbEnergy          = qcOutChan->sfbEnergy;
+            psyOutChan->sfbEnergyLdData    = qcOutChan->sfbEnergyLdData;
+            psyOutChan->sfbMinSnrLdData    = qcOutChan->sfbMinSnrLdData;
+            psyOutChan->sfbThresholdLdData = qcOutChan->sfbThresholdLdData;
+
+        }
+
+        FDK_PROF_START(tPsy);
+        FDKaacEnc_psyMain(elInfo.nChannelsInEl,
+                          hPsy->psyElement[el],
+                          hAacEnc->psyDynamic[worker],
+                          hPsy->psyConf,
+                          psyOut->psyOutElement[el],
+                          job->pInput,
+                          cm->elInfo[el].ChannelIndex
+                );
+        FDK_PROF_STOP(FDK_PROF_ENC_PSY, tPsy);
+
+        /* FormFactor, Pe and staticBitDemand calculation */
+        job->errorStatus[el] = FDKaacEnc_QCMainPrepare(&elInfo,
+                                                        job->adjThrStateElem[el],
+                                                        psyOut->psyOutElement[el],
+                                                        qcOut->qcElement[el],
+                                                        hAacEnc->aot,
+                                                        hAacEnc->config->syntaxFlags,
+                                                        hAacEnc->config->epConfig);
+    }
+}
+
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_LookAheadFrame
+    description:  run the look-ahead psych on the newest frame and keep its pe;
+                  uses psyOut and qcOut as scratch, the encoded frame overwrites them
+    returns:      error code
+
+  ---------------------------------------------------------------------------*/
+AAC_ENCODER_ERROR FDKaacEnc_LookAheadFrame( HANDLE_AAC_ENC       hAacEnc,
+                                            const PCM_INPUT*     pInput
+                                          )
+{
+    CHANNEL_MAPPING *cm = &hAacEnc->channelMapping;
+    ENCODE_ELEMENT_JOB job;
+    INT el;
+
+    if (hAacEnc->lookAhead <= 0) {
+        return AAC_ENC_OK;
+    }
+
+    job.hAacEnc         = hAacEnc;
+    job.psyKernel       = hAacEnc->psyKernelLookAhead;
+    job.adjThrStateElem = hAacEnc->adjThrStateLookAhead;
+    job.pInput          = pInput;
+    job.psyOut          = hAacEnc->psyOut[0];
+    job.qcOut           = hAacEnc->qcOut[0];
+
+    FDKworkerPoolRun(hAacEnc->hWorkerPool, FDKaacEnc_EncodeElementJob, &job, cm->nElements);
+
+    for (el=0; el<cm->nElements; el++) {
+        ELEMENT_INFO elInfo = cm->elInfo[el];
+
+        hAacEnc->lookAheadPe[hAacEnc->lookAheadPos][el] = 0;
+
+        if ( (elInfo.elType == ID_SCE)
+          || (elInfo.elType == ID_CPE)
+          || (elInfo.elType == ID_LFE) )
+        {
+            if (job.errorStatus[el] != AAC_ENC_OK)
+              return job.errorStatus[el];
+
+            hAacEnc->lookAheadPe[hAacEnc->lookAheadPos][el] = job.qcOut->qcElement[el]->peData.pe;
+        }
+    }
+
+    hAacEnc->lookAheadPos = (hAacEnc->lookAheadPos + 1) % (hAacEnc->lookAhead + 1);
+
+    return AAC_ENC_OK;
+}
+
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_AnalyseFrame
+    description:  first pass of two-pass encoding: run psych and pe calculation,
+                  write the pe of each element as 16 bit big endian value;
+                  uses psyOut and qcOut, nothing is encoded
+    returns:      error code
+
+  ---------------------------------------------------------------------------*/
+AAC_ENCODER_ERROR FDKaacEnc_AnalyseFrame( HANDLE_AAC_ENC       hAacEnc,
+                                          const PCM_INPUT*     pInput,
+                                          UCHAR*               pStats,
+                                          INT*                 nStatsBytes
+                                        )
+{
+    CHANNEL_MAPPING *cm = &hAacEnc->channelMapping;
+    ENCODE_ELEMENT_JOB job;
+    INT el;
+
+    job.hAacEnc         = hAacEnc;
+    job.psyKernel       = hAacEnc->psyKernel;
+    job.adjThrStateElem = hAacEnc->qcKernel->hAdjThr->adjThrStateElem;
+    job.pInput          = pInput;
+    job.psyOut          = hAacEnc->psyOut[0];
+    job.qcOut           = hAacEnc->qcOut[0];
+
+    FDKworkerPoolRun(hAacEnc->hWorkerPool, FDKaacEnc_EncodeElementJob, &job, cm->nElements);
+
+    for (el=0; el<cm->nElements; el++) {
+        ELEMENT_INFO elInfo = cm->elInfo[el];
+        INT pe = 0;
+
+        if ( (elInfo.elType == ID_SCE)
+          || (elInfo.elType == ID_CPE)
+          || (elInfo.elType == ID_LFE) )
+        {
+            if (job.errorStatus[el] != AAC_ENC_OK)
+              return job.errorStatus[el];
+
+            pe = fixMax(0, fixMin(job.qcOut->qcElement[el]->peData.pe, 0xFFFF));
+        }
+        pStats[2*el]   = (UCHAR)(pe>>8);
+        pStats[2*el+1] = (UCHAR)(pe);
+    }
+
+    *nStatsBytes = 2*cm->nElements;
+
+    return AAC_ENC_OK;
+}
+
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_SetPassStats
+    description:  set the first pass statistics, the bit plan itself is made
+                  with the first frame of the second pass
+    returns:      error code
+
+  ---------------------------------------------------------------------------*/
+AAC_ENCODER_ERROR FDKaacEnc_SetPassStats( HANDLE_AAC_ENC       hAacEnc,
+                                          const UCHAR*         pStats,
+                                          INT                  statsSize
+                                        )
+{
+    CHANNEL_MAPPING *cm = &hAacEnc->channelMapping;
+    INT recordSize = 2*cm->nElements;
+    INT el, n;
+
+    if (hAacEnc->pPassNeed != NULL) {
+        FDKfree(hAacEnc->pPassNeed);
+        hAacEnc->pPassNeed = NULL;
+    }
+    hAacEnc->pPassStats = NULL;
+    hAacEnc->passFrames = 0;
+    hAacEnc->passFrame  = 0;
+
+    for (el=0; el<cm->nElements; el++) {
+        hAacEnc->qcKernel->hAdjThr->adjThrStateElem[el]->passBitFac = 0;
+    }
+
+    if ( (pStats == NULL) || (statsSize <= 0) ) {
+        return AAC_ENC_OK;
+    }
+    if ( (recordSize == 0) || ((statsSize % recordSize) != 0) ) {
+        return AAC_ENC_INVALID_PASS_STATS;
+    }
+
+    hAacEnc->pPassNeed = (INT*)FDKcalloc((statsSize/recordSize)*cm->nElements, sizeof(INT));
+    if (hAacEnc->pPassNeed == NULL) {
+        return AAC_ENC_NO_MEMORY;
+    }
+
+    hAacEnc->pPassStats = pStats;
+    hAacEnc->passFrames = statsSize/recordSize;
+
+    for (el=0; el<cm->nElements; el++) {
+        INT64 peSum = 0;
+        for (n=0; n<hAacEnc->passFrames; n++) {
+            peSum += (pStats[n*recordSize+2*el]<<8) | pStats[n*recordSize+2*el+1];
+        }
+        hAacEnc->passMeanPe[el] = (INT)(peSum / hAacEnc->passFrames);
+    }
+
+    return AAC_ENC_OK;
+}
+
+/* bits demanded by a frame of the first pass relative to the average bits, in Q(PASS_BITFAC_Q) */
+static INT FDKaacEnc_PassDemand(HANDLE_AAC_ENC hAacEnc, INT n, INT el)
+{
+    const UCHAR *pRec = hAacEnc->pPassStats + 2*(n*hAacEnc->channelMapping.nElements + el);
+    INT pe = (pRec[0]<<8) | pRec[1];
+
+    if (hAacEnc->passMeanPe[el] <= 0) {
+        return (1<<PASS_BITFAC_Q);
+    }
+    return fixMin((pe<<PASS_BITFAC_Q) / hAacEnc->passMeanPe[el], (2<<PASS_BITFAC_Q)-1);
+}
+
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_PassBitFac
+    description:  second pass of two-pass encoding: set the planned bits of the
+                  next frame. Each frame demands bits in proportion to its pe.
+                  Walking backwards through the statistics once yields the
+                  bitreservoir fill needed ahead of each frame to serve all
+                  following demands; a frame spends only what leaves that fill
+                  in the bitreservoir and saves nothing the bitreservoir
+                  cannot take. Each element plans against its own share of
+                  the bitreservoir, like FDKaacEnc_bitresCalcBitFac() applies
+                  the factor.
+
+  ---------------------------------------------------------------------------*/
+static void FDKaacEnc_PassBitFac(HANDLE_AAC_ENC hAacEnc, INT avgTotalBits)
+{
+    CHANNEL_MAPPING *cm  = &hAacEnc->channelMapping;
+    QC_STATE        *hQC = hAacEnc->qcKernel;
+    const INT        unit = (1<<PASS_BITFAC_Q);
+    INT n = hAacEnc->passFrame++;
+    INT el;
+
+    for (el=0; el<cm->nElements; el++) {
+        hQC->hAdjThr->adjThrStateElem[el]->passBitFac = 0;
+    }
+
+    /* the element shares of the bitreservoir, as FDKaacEnc_QCMain() will see them */
+    if ( (n >= hAacEnc->passFrames) || (avgTotalBits <= 0)
+      || (FDKaacEnc_BitResRedistribution(hQC, cm, avgTotalBits) != AAC_ENC_OK) ) {
+        return;
+    }
+
+    for (el=0; el<cm->nElements; el++) {
+        ELEMENT_INFO  elInfo = cm->elInfo[el];
+        ELEMENT_BITS *elBits = hQC->elementBits[el];
+        INT avgBitsEl, capacity, fill, needNext, bitFac;
+
+        if ( (elInfo.elType != ID_SCE)
+          && (elInfo.elType != ID_CPE)
+          && (elInfo.elType != ID_LFE) )
+        {
+            continue;
+        }
+
+        /* bitreservoir share and its fill level in frames of average bits of the element */
+        avgBitsEl = (INT)fMult(elBits->relativeBitsEl, (FIXP_DBL)avgTotalBits);
+        if (avgBitsEl <= 0) {
+            continue;
+        }
+        capacity = (fixMax(0, elBits->maxBitResBitsEl)<<PASS_BITFAC_Q) / avgBitsEl;
+        fill     = (fixMax(0, fixMin(elBits->bitResLevelEl, elBits->maxBitResBitsEl))<<PASS_BITFAC_Q) / avgBitsEl;
+
+        if (n == 0) {
+            INT k, need = 0;
+            for (k=hAacEnc->passFrames-1; k>=0; k--) {
+                need = fixMax(0, fixMin(need + FDKaacEnc_PassDemand(hAacEnc, k, el) - unit, capacity));
+                hAacEnc->pPassNeed[k*cm->nElements+el] = need;
+            }
+        }
+
+        needNext = (n+1 < hAacEnc->passFrames) ? hAacEnc->pPassNeed[(n+1)*cm->nElements+el] : 0;
+        bitFac   = FDKaacEnc_PassDemand(hAacEnc, n, el);
+
+        bitFac = fixMin(bitFac, fill + unit - needNext);
+        bitFac = fixMax(bitFac, fill + unit - capacity);
+
+        hQC->hAdjThr->adjThrStateElem[el]->passBitFac = fixMax(1, fixMin(bitFac, 2*unit-1));
+    }
+}
+
 /*---------------------------------------------------------------------------
 
     functionname: FDKaacEnc_EncodeFrame
@@ -711,7 +1204,7 @@ bail:
   ---------------------------------------------------------------------------*/
 AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,          /* encoder handle */
                                          HANDLE_TRANSPORTENC  hTpEnc,
-                                         INT_PCM* RESTRICT    inputBuffer,
+                                         const PCM_INPUT*     pInput,
                                          INT*                 nOutBytes,
                                          AACENC_EXT_PAYLOAD   extPayload[MAX_TOTAL_EXT_PAYLOADS]
                                        )
@@ -719,6 +1212,7 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,
     AAC_ENCODER_ERROR ErrorStatus;
     int    el, n, c=0;
     UCHAR  extPayloadUsed[MAX_TOTAL_EXT_PAYLOADS];
+    ENCODE_ELEMENT_JOB job;
 
     CHANNEL_MAPPING *cm      = &hAacEnc->channelMapping;
 
@@ -733,7 +1227,17 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,
     qcOut->staticBits     = 0; /* sum up side info bits of each element */
     qcOut->totalNoRedPe   = 0; /* sum up PE */
 
-    /* advance psychoacoustics */
+    /* advance psychoacoustics and prepare quantization of all channel elements */
+    job.hAacEnc         = hAacEnc;
+    job.psyKernel       = hAacEnc->psyKernel;
+    job.adjThrStateElem = hAacEnc->qcKernel->hAdjThr->adjThrStateElem;
+    job.pInput          = pInput;
+    job.psyOut          = psyOut;
+    job.qcOut           = qcOut;
+
+    FDKworkerPoolRun(hAacEnc->hWorkerPool, FDKaacEnc_EncodeElementJob, &job, cm->nElements);
+
+    /* join: collect element results in element order */
     for (el=0; el<cm->nElements; el++) {
         ELEMENT_INFO elInfo = cm->elInfo[el];
 
@@ -741,44 +1245,8 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,
           || (elInfo.elType == ID_CPE)
           || (elInfo.elType == ID_LFE) )
         {
-            int ch;
-
-            /* update pointer!*/
-            for(ch=0;ch<elInfo.nChannelsInEl;ch++) {
-                PSY_OUT_CHANNEL *psyOutChan = psyOut->psyOutElement[el]->psyOutChannel[ch];
-                QC_OUT_CHANNEL  *qcOutChan = qcOut->qcElement[el]->qcOutChannel[ch];
-
-                psyOutChan->mdctSpectrum       = qcOutChan->mdctSpectrum;
-                psyOutChan->sfbSpreadEnergy  = qcOutChan->sfbSpreadEnergy;
-                psyOutChan->sfbEnergy          = qcOutChan->sfbEnergy;
-                psyOutChan->sfbEnergyLdData    = qcOutChan->sfbEnergyLdData;
-                psyOutChan->sfbMinSnrLdData    = qcOutChan->sfbMinSnrLdData;
-                psyOutChan->sfbThresholdLdData = qcOutChan->sfbThresholdLdData;
-
-            }
-
-            FDKaacEnc_psyMain(elInfo.nChannelsInEl,
-                              hAacEnc->psyKernel->psyElement[el],
-                              hAacEnc->psyKernel->psyDynamic,
-                              hAacEnc->psyKernel->psyConf,
-                              psyOut->psyOutElement[el],
-                              inputBuffer,
-                              cm->elInfo[el].ChannelIndex,
-                              cm->nChannels
-
-                    );
-
-            /* FormFactor, Pe and staticBitDemand calculation */
-            ErrorStatus = FDKaacEnc_QCMainPrepare(&elInfo,
-                                                   hAacEnc->qcKernel->hAdjThr->adjThrStateElem[el],
-                                                   psyOut->psyOutElement[el],
-                                                   qcOut->qcElement[el],
-                                                   hAacEnc->aot,
-                                                   hAacEnc->config->syntaxFlags,
-                                                   hAacEnc->config->epConfig);
-
-            if (ErrorStatus != AAC_ENC_OK)
-              return ErrorStatus;
+            if (job.errorStatus[el] != AAC_ENC_OK)
+              return job.errorStatus[el];
 
             /*-------------------------------------------- */
 
@@ -877,6 +1345,17 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,
       qcOut->globalExtBits += EL_ID_BITS;  /* add bits for ID_END */
     }
 
+    /* mean pe of the look-ahead window, i.e. of this frame and the already analysed ones */
+    if (hAacEnc->lookAhead > 0) {
+        for (el=0; el<cm->nElements; el++) {
+            INT k, peSum = 0;
+            for (k=0; k<=hAacEnc->lookAhead; k++) {
+                peSum += hAacEnc->lookAheadPe[k][el];
+            }
+            hAacEnc->qcKernel->hAdjThr->adjThrStateElem[el]->peLookAhead = peSum / (hAacEnc->lookAhead+1);
+        }
+    }
+
     /* build bitstream all nSubFrames */
     {
         INT totalBits    = 0;   /* Total AU bits */;
@@ -898,6 +1377,11 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,
             avgTotalBits *= hAacEnc->config->nSubFrames;
         }
 
+        /* bits planned by the second pass of two-pass encoding */
+        if (hAacEnc->pPassStats != NULL) {
+            FDKaacEnc_PassBitFac(hAacEnc, avgTotalBits);
+        }
+
         /* Make first estimate of transport header overhead.
            Take maximum possible frame size into account to prevent bitreservoir underrun. */
         hAacEnc->qcKernel->globHdrBits = transportEnc_GetStaticBits(hTpEnc, avgTotalBits + hAacEnc->qcKernel->bitResTot);
@@ -907,6 +1391,7 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,
         /*-------------------------------------------- */
         /*-------------------------------------------- */
 
+        FDK_PROF_START(tQc);
         ErrorStatus = FDKaacEnc_QCMain(hAacEnc->qcKernel,
                                        hAacEnc->psyOut,
                                        hAacEnc->qcOut,
@@ -915,6 +1400,7 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,
                                       ,hAacEnc->aot,
                                        hAacEnc->config->syntaxFlags,
                                        hAacEnc->config->epConfig);
+        FDK_PROF_STOP(FDK_PROF_ENC_QC, tQc);
 
         if (ErrorStatus != AAC_ENC_OK)
             return ErrorStatus;
@@ -952,13 +1438,16 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,
 
         /* for ( all sub frames ) ... */
               /* write bitstream header */
+              FDK_PROF_START(tTp);
               transportEnc_WriteAccessUnit(
                     hTpEnc,
                     totalBits,
                     FDKaacEnc_EncBitresToTpBitres(hAacEnc),
                     cm->nChannelsEff);
+              FDK_PROF_STOP(FDK_PROF_ENC_TRANSPORT, tTp);
 
               /* write bitstream */
+              FDK_PROF_START(tBs);
               ErrorStatus = FDKaacEnc_WriteBitstream(
                     hTpEnc,
                     cm,
@@ -968,12 +1457,15 @@ AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,
                     hAacEnc->aot,
                     hAacEnc->config->syntaxFlags,
                     hAacEnc->config->epConfig);
+              FDK_PROF_STOP(FDK_PROF_ENC_BITSTREAM, tBs);
 
               if (ErrorStatus != AAC_ENC_OK)
                 return ErrorStatus;
 
               /* transportEnc_EndAccessUnit() is being called inside FDKaacEnc_WriteBitstream() */
+              FDK_PROF_START(tFrame);
               transportEnc_GetFrame(hTpEnc, nOutBytes);
+              FDK_PROF_STOP(FDK_PROF_ENC_TRANSPORT, tFrame);
 
     } /* -end- if (curFrame==hAacEnc->qcKernel->nSubFrames) */
 
@@ -1000,8 +1492,24 @@ void FDKaacEnc_Close( HANDLE_AAC_ENC*  phAacEnc)   /* encoder handle */
    if (hAacEnc->dynamic_RAM != NULL)
        FreeAACdynamic_RAM(&hAacEnc->dynamic_RAM);
 
+    FDKworkerPoolClose(&hAacEnc->hWorkerPool);
+
+    for (int n=1; n<FDK_MAX_WORKERS; n++) {
+      FreeRam_aacEnc_PsyDynamicWorker(&hAacEnc->psyDynamic[n]);
+    }
+
     FDKaacEnc_PsyClose(&hAacEnc->psyKernel,hAacEnc->psyOut);
 
+    FDKaacEnc_PsyClose(&hAacEnc->psyKernelLookAhead, NULL);
+
+    for (int el=0; el<(8); el++) {
+      FreeRam_aacEnc_AdjThrStateElement(&hAacEnc->adjThrStateLookAhead[el]);
+    }
+
+    if (hAacEnc->pPassNeed != NULL) {
+      FDKfree(hAacEnc->pPassNeed);
+    }
+
     FDKaacEnc_QCClose(&hAacEnc->qcKernel, hAacEnc->qcOut);
 
     FreeRam_aacEnc_AacEncoder(phAacEnc);
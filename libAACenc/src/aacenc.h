@@ -121,6 +121,7 @@ typedef enum {
   AAC_ENC_INVALID_FRAME_LENGTH  = 0x2080,             /*!< Invalid frame length.                                                      */
   AAC_ENC_INVALID_N_CHANNELS    = 0x20e0,             /*!< Invalid amount of audio input channels.                                    */
   AAC_ENC_INVALID_SFB_TABLE     = 0x2140,             /*!< Internal encoder error.                                                    */
+  AAC_ENC_INVALID_PASS_STATS    = 0x2160,             /*!< First pass statistics do not match the channel configuration.              */
 
   AAC_ENC_UNSUPPORTED_AOT            = 0x3000,        /*!< The Audio Object Type (AOT) is not supported.                              */
   AAC_ENC_UNSUPPORTED_BITRATE        = 0x3020,        /*!< The chosen bitrate is not supported.                                       */
@@ -161,6 +162,8 @@ typedef enum {
 
 #define MAX_TOTAL_EXT_PAYLOADS  (((8) * (1)) + (2+2))
 
+#define AACENC_MAX_LOOKAHEAD    (32)  /* maximum look-ahead window in frames */
+
 
 typedef enum {
   AACENC_BR_MODE_INVALID = -1,  /*!< Invalid bitrate mode.                            */
@@ -219,6 +222,10 @@ struct AACENC_CONFIG {
   UCHAR useIS;                  /* flag: use intensity coding */
 
   UCHAR useRequant;             /* flag: use afterburner */
+  UCHAR complexity;             /* speed preset, see ENC_COMPLEXITY */
+
+  INT   nThreads;               /* number of workers for element-parallel processing, 0 or 1: single-threaded */
+  INT   lookAhead;              /* look-ahead window in frames for bit distribution, 0: disabled */
 };
 
 typedef struct {
@@ -230,6 +237,26 @@ typedef struct {
 
 typedef struct AAC_ENC *HANDLE_AAC_ENC;
 
+/* encoder speed presets */
+typedef enum {
+  ENC_COMPLEXITY_FULL    = 0,   /* full search */
+  ENC_COMPLEXITY_FAST    = 1,   /* no scalefactor assimilation over several bands */
+  ENC_COMPLEXITY_FASTEST = 2    /* no analysis by synthesis, single pass sectioning, reduced TNS */
+} ENC_COMPLEXITY;
+
+/* bit reservoir handoff at segment boundaries */
+typedef enum {
+  BITRES_HANDOFF_NONE  = 0,     /* normal operation */
+  BITRES_HANDOFF_START = 1,     /* next frame starts with an empty bit reservoir */
+  BITRES_HANDOFF_END   = 2      /* next frame leaves an empty bit reservoir, saved bits become fill bits */
+} BITRES_HANDOFF;
+
+/* time signal of one frame handed to the core encoder */
+typedef struct {
+  INT_PCM          *pChannel[(8)];  /* first sample of each input channel */
+  INT               stride;         /* distance between two consecutive samples of one channel */
+} PCM_INPUT;
+
 /**
  * \brief Calculate framesize in bits for given bit rate, frame length and sampling rate.
  *
@@ -299,6 +326,16 @@ INT FDKaacEnc_LimitBitrate(
  INT FDKaacEnc_GetVBRBitrate(INT bitrateMode, CHANNEL_MODE channelMode);
 
 
+/*-----------------------------------------------------------------------------
+
+     functionname: FDKaacEnc_BitResHandoff
+     description:  hand off the bit reservoir at a segment boundary, only
+                   effective in constant bitrate mode
+     returns:      ---
+
+ ------------------------------------------------------------------------------*/
+void FDKaacEnc_BitResHandoff(HANDLE_AAC_ENC hAacEnc, BITRES_HANDOFF handoff);
+
 /*-----------------------------------------------------------------------------
 
      functionname: FDKaacEnc_AacInitDefaultConfig
@@ -337,11 +374,55 @@ AAC_ENCODER_ERROR FDKaacEnc_Initialize(HANDLE_AAC_ENC     hAacEncoder,   /* poin
 
 AAC_ENCODER_ERROR FDKaacEnc_EncodeFrame( HANDLE_AAC_ENC       hAacEnc,         /* encoder handle */
                                          HANDLE_TRANSPORTENC  hTpEnc,
-                                         INT_PCM*             inputBuffer,
+                                         const PCM_INPUT*     pInput,
                                          INT*                 numOutBytes,
                                          AACENC_EXT_PAYLOAD   extPayload[MAX_TOTAL_EXT_PAYLOADS]
                                        );
 
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_LookAheadFrame
+    description:  analyse the newest frame of the look-ahead window, the
+                  frame itself is encoded look-ahead frames later
+    returns:      0 if success
+
+  ---------------------------------------------------------------------------*/
+
+AAC_ENCODER_ERROR FDKaacEnc_LookAheadFrame( HANDLE_AAC_ENC       hAacEnc,      /* encoder handle */
+                                            const PCM_INPUT*     pInput
+                                          );
+
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_AnalyseFrame
+    description:  first pass of two-pass encoding: psychoacoustics and pe
+                  calculation only, writes the statistics record of the frame
+    returns:      0 if success
+
+  ---------------------------------------------------------------------------*/
+
+AAC_ENCODER_ERROR FDKaacEnc_AnalyseFrame( HANDLE_AAC_ENC       hAacEnc,        /* encoder handle */
+                                          const PCM_INPUT*     pInput,
+                                          UCHAR*               pStats,
+                                          INT*                 nStatsBytes
+                                        );
+
+/*---------------------------------------------------------------------------
+
+    functionname: FDKaacEnc_SetPassStats
+    description:  set the first pass statistics for the second pass of
+                  two-pass encoding, NULL for single pass encoding; the
+                  second pass restarts at the first frame
+    returns:      0 if success, AAC_ENC_INVALID_PASS_STATS if the statistics
+                  do not fit the channel configuration
+
+  ---------------------------------------------------------------------------*/
+
+AAC_ENCODER_ERROR FDKaacEnc_SetPassStats( HANDLE_AAC_ENC       hAacEnc,        /* encoder handle */
+                                          const UCHAR*         pStats,
+                                          INT                  statsSize
+                                        );
+
 /*---------------------------------------------------------------------------
 
     functionname:FDKaacEnc_Close
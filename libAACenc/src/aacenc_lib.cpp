@@ -94,6 +94,7 @@ amm-info@iis.fraunhofer.de
 
 #include "aacEnc_ram.h"
 #include "FDK_core.h" /* FDK_tools versioning info */
+#include "FDK_thread.h"
 
 /* Encoder library info */
 #define AACENCODER_LIB_VL0 3
@@ -151,6 +152,7 @@ typedef struct {
     UINT              userBitrateMode;
     UINT              userBandwidth;
     UINT              userAfterburner;
+    UINT              userComplexity;        /*!< Encoder speed preset. */
     UINT              userFramelength;
     UINT              userAncDataRate;
     UINT              userPeakBitrate;
@@ -175,6 +177,14 @@ typedef struct {
     UCHAR             userSbrEnabled;        /*!< Enable SBR for ELD. */
     UINT              userSbrRatio;          /*!< SBR sampling rate ratio. Dual- or single-rate. */
 
+    UCHAR             userNumThreads;        /*!< Number of workers for element-parallel encoding. */
+
+    UCHAR             userLookAhead;         /*!< Look-ahead window in frames. */
+
+    UCHAR             userPass;              /*!< Two-pass encoding: 0 single pass, 1 first pass, 2 second pass. */
+
+    UCHAR             userInputLayout;       /*!< Input audio data layout, interleaved or planar. */
+
 } USER_PARAM;
 
 ////////////////////////////////////////////////////////////////////////////////////
@@ -205,6 +215,7 @@ struct AACENCODER
 
     /* Transport */
     HANDLE_TRANSPORTENC      hTpEnc;
+    INT                      sbrHeaderInConf;   /* The ELD SBR header has been written into the configuration. */
 
     /* Output */
     UCHAR                   *outBuffer;         /* Internal bitstream buffer */
@@ -219,6 +230,22 @@ struct AACENCODER
     INT                      nZerosAppended;    /* appended zeros at end of file*/
     INT                      nDelay;            /* encoder delay */
 
+    /* Client ring buffer input */
+    INT_PCM                 *pInputRing;        /* Client-owned ring buffer, NULL if not registered. */
+    INT                      inputRingSize;     /* Ring buffer size in samples. */
+    INT                      inputRingLayout;   /* 0: interleaved, 1: planar. */
+    INT                      inputRingReadPos;  /* Read position in interleaved sample order. */
+    INT                      inputRingFill;     /* Number of announced samples not yet consumed. */
+
+    /* Look-ahead delay line */
+    INT_PCM                 *pLookAheadBuffer;  /* Delayed input frames, NULL if look-ahead is disabled. */
+    INT                      lookAheadSize;     /* Delay line size in samples. */
+    INT                      lookAheadPos;      /* Position of the oldest frame. */
+
+    /* Two-pass encoding */
+    const UCHAR             *pPassStats;        /* Client-owned first pass statistics, NULL if not registered. */
+    UINT                     passStatsSize;     /* Size of the statistics in bytes. */
+
     AACENC_EXT_PAYLOAD       extPayload [MAX_TOTAL_EXT_PAYLOADS];
     /* Extension payload */
     UCHAR                    extPayloadData [(1)][(8)][MAX_PAYLOAD_SIZE];
@@ -239,6 +266,10 @@ struct AACENCODER
    /* Capability flags */
    UINT                      CAPF_tpEnc;
 
+#if defined(FDK_PROFILE)
+   FDK_PROF_STATS            prof[FDK_MAX_WORKERS]; /* timing statistics per worker */
+#endif
+
 } ;
 
 typedef struct
@@ -525,6 +556,10 @@ static INT getBufDescIdx(
 {
     INT i, idx = -1;
 
+    if (pBufDesc==NULL) {
+      return idx;
+    }
+
     for (i=0; i<pBufDesc->numBufs; i++) {
       if ( (AACENC_BufferIdentifier)pBufDesc->bufferIdentifiers[i] == identifier ) {
         idx = i;
@@ -561,7 +596,10 @@ AAC_ENCODER_ERROR aacEncDefaultConfig(HANDLE_AACENC_CONFIG hAacConfig,
     config->userPns         = hAacConfig->usePns;
     config->userIntensity   = hAacConfig->useIS;
     config->userAfterburner = hAacConfig->useRequant;
+    config->userComplexity  = hAacConfig->complexity;
     config->userFramelength = (UINT)-1;
+    config->userNumThreads  = hAacConfig->nThreads;
+    config->userLookAhead   = hAacConfig->lookAhead;
 
     if (hAacConfig->syntaxFlags & AC_ER_VCB11) {
       config->userErTools  |= 0x01;
@@ -582,6 +620,9 @@ AAC_ENCODER_ERROR aacEncDefaultConfig(HANDLE_AACENC_CONFIG hAacConfig,
 
     config->userAncDataRate    = 0;
 
+    config->userInputLayout    = 0;    /* interleaved input audio data */
+    config->userPass           = 0;    /* single pass encoding */
+
     /* SBR rate is set to 0 here, which means it should be set automatically
        in FDKaacEnc_AdjustEncSettings() if the user did not set a rate
        expilicitely. */
@@ -757,6 +798,8 @@ AACENC_ERROR FDKaacEnc_AdjustEncSettings(HANDLE_AACENCODER hAacEncoder,
     hAacConfig->bitrateMode     = config->userBitrateMode;
     hAacConfig->bandWidth       = config->userBandwidth;
     hAacConfig->useRequant      = config->userAfterburner;
+    hAacConfig->complexity      = config->userComplexity;
+    hAacConfig->nThreads        = config->userNumThreads;
 
     hAacConfig->audioObjectType = config->userAOT;
     hAacConfig->anc_Rate        = config->userAncDataRate;
@@ -967,6 +1010,10 @@ AACENC_ERROR FDKaacEnc_AdjustEncSettings(HANDLE_AACENCODER hAacEncoder,
         return AACENC_INVALID_CONFIG;      /* not enough channels allocated */
     }
 
+    /* Look-ahead bit distribution needs a bit reservoir and the time signal at core sampling rate.
+       Two-pass encoding plans the bit distribution itself. */
+    hAacConfig->lookAhead = ( (hAacConfig->bitrateMode==AACENC_BR_MODE_CBR) && !isSbrActive(hAacConfig) && (config->userPass==0) ) ? config->userLookAhead : 0;
+
     /* Meta data restriction. */
     switch (hAacConfig->audioObjectType)
     {
@@ -1002,6 +1049,7 @@ INT aacenc_SbrCallback(
   HANDLE_AACENCODER hAacEncoder = (HANDLE_AACENCODER)self;
 
   sbrEncoder_GetHeader(hAacEncoder->hEnvEnc, hBs, elementIndex, 0);
+  hAacEncoder->sbrHeaderInConf = 1;
 
   return 0;
 }
@@ -1020,6 +1068,18 @@ static AACENC_ERROR aacEncInit(HANDLE_AACENCODER  hAacEncoder,
 
     INT frameLength = hAacConfig->framelength;
 
+    /* A reset of the states alone keeps the configuration already handed out. */
+    const INT keepConf = !(InitFlags & AACENC_INIT_CONFIG);
+
+    if ( !keepConf ) {
+        hAacEncoder->sbrHeaderInConf = 0;
+    }
+
+    /* The SBR encoder derives core configuration and delay from the input configuration. */
+    if ( (InitFlags & AACENC_INIT_STATES) && isSbrActive(hAacConfig) ) {
+        InitFlags |= AACENC_INIT_CONFIG;
+    }
+
     if ( (InitFlags & AACENC_INIT_CONFIG) )
     {
         CHANNEL_MODE prevChMode = hAacConfig->channelMode;
@@ -1036,8 +1096,10 @@ static AACENC_ERROR aacEncInit(HANDLE_AACENCODER  hAacEncoder,
         }
     }
 
-    /* Clear input buffer */
-    if ( InitFlags == AACENC_INIT_ALL ) {
+    /* Clear input buffer, also on a reset to a new stream */
+    if ( (InitFlags == AACENC_INIT_ALL)
+      || ((InitFlags & AACENC_INIT_STATES) && (InitFlags & AACENC_RESET_INBUFFER)) )
+    {
         FDKmemclear(hAacEncoder->inputBuffer, sizeof(INT_PCM)*hAacEncoder->nMaxAacChannels*INPUTBUFFER_SIZE);
     }
 
@@ -1101,6 +1163,21 @@ static AACENC_ERROR aacEncInit(HANDLE_AACENCODER  hAacEncoder,
             return AACENC_INIT_SBR_ERROR;
         }
 
+        /* The SBR init enables the in-band SBR header again. Keep it out of the payload
+           if the kept configuration carries it, as a new encoder does after aacEncInfo(). */
+        if ( keepConf && hAacEncoder->sbrHeaderInConf ) {
+            FDK_BITSTREAM hdrBs;
+            UCHAR hdrBuf[64];
+            int el;
+
+            FDKinitBitStream(&hdrBs, hdrBuf, sizeof(hdrBuf), 0, BS_WRITER);
+            for (el=0; el<channelMapping.nElements; el++) {
+                if ( (channelMapping.elInfo[el].elType == ID_SCE) || (channelMapping.elInfo[el].elType == ID_CPE) ) {
+                    sbrEncoder_GetHeader(*hSbrEncoder, &hdrBs, el, 0);
+                }
+            }
+        }
+
         if (hAacConfig->nChannels == 1) {
             hAacConfig->channelMode = MODE_1;
         }
@@ -1159,6 +1236,15 @@ static AACENC_ERROR aacEncInit(HANDLE_AACENCODER  hAacEncoder,
             return AACENC_INIT_AAC_ERROR;
         }
 
+        /* second pass restarts with the first frame of the statistics */
+        err = FDKaacEnc_SetPassStats(hAacEncoder->hAacEnc,
+                                     (config->userPass==2) ? hAacEncoder->pPassStats : NULL,
+                                     (INT)hAacEncoder->passStatsSize);
+
+        if (err != AAC_ENC_OK) {
+            return AACENC_INIT_AAC_ERROR;
+        }
+
     } /* aac initialization */
 
     /*
@@ -1186,7 +1272,9 @@ static AACENC_ERROR aacEncInit(HANDLE_AACENCODER  hAacEncoder,
             return AACENC_INIT_META_ERROR;
         }
 
-        hAacEncoder->nDelay += FDK_MetadataEnc_GetDelay(hAacEncoder->hMetadataEnc);
+        if ( (InitFlags & AACENC_INIT_CONFIG) ) {
+            hAacEncoder->nDelay += FDK_MetadataEnc_GetDelay(hAacEncoder->hMetadataEnc);
+        }
     }
 
     /*
@@ -1198,11 +1286,37 @@ static AACENC_ERROR aacEncInit(HANDLE_AACENCODER  hAacEncoder,
 
         hAacEncoder->nSamplesToRead = frameLength * config->nChannels;
 
+        /* The input is delayed by the look-ahead window. */
+        hAacEncoder->nDelay += hAacConfig->lookAhead * frameLength;
+
         /* Make nDelay comparison compatible with config->nSamplesRead */
         hAacEncoder->nDelay *= config->nChannels;
 
+        if ( hAacEncoder->lookAheadSize != hAacConfig->lookAhead*hAacEncoder->nSamplesToRead ) {
+            if (hAacEncoder->pLookAheadBuffer!=NULL) {
+                FDKfree(hAacEncoder->pLookAheadBuffer);
+                hAacEncoder->pLookAheadBuffer = NULL;
+            }
+            hAacEncoder->lookAheadSize = 0;
+            hAacEncoder->lookAheadPos  = 0;
+
+            if (hAacConfig->lookAhead > 0) {
+                hAacEncoder->pLookAheadBuffer = (INT_PCM*)FDKcalloc(hAacConfig->lookAhead*hAacEncoder->nSamplesToRead, sizeof(INT_PCM));
+                if (hAacEncoder->pLookAheadBuffer==NULL) {
+                    return AACENC_MEMORY_ERROR;
+                }
+                hAacEncoder->lookAheadSize = hAacConfig->lookAhead*hAacEncoder->nSamplesToRead;
+            }
+        }
+
     } /* parameter changed */
 
+    /* Clear look-ahead delay line */
+    if ( (InitFlags & AACENC_INIT_STATES) && (hAacEncoder->pLookAheadBuffer!=NULL) ) {
+        FDKmemclear(hAacEncoder->pLookAheadBuffer, sizeof(INT_PCM)*hAacEncoder->lookAheadSize);
+        hAacEncoder->lookAheadPos = 0;
+    }
+
     return AACENC_OK;
 }
 
@@ -1375,6 +1489,11 @@ AACENC_ERROR aacEncClose(HANDLE_AACENCODER *phAacEncoder)
            hAacEncoder->inputBuffer = NULL;
        }
 
+       if (hAacEncoder->pLookAheadBuffer!=NULL) {
+           FDKfree(hAacEncoder->pLookAheadBuffer);
+           hAacEncoder->pLookAheadBuffer = NULL;
+       }
+
        if (hAacEncoder->outBuffer) {
          FreeRam_bsOutbuffer(&hAacEncoder->outBuffer);
        }
@@ -1399,6 +1518,346 @@ bail:
     return err;
 }
 
+AACENC_ERROR aacEncoder_GetMemRequirements(
+        const UINT                encModules,
+        const UINT                maxChannels,
+        FDK_MEM_INFO             *pMemInfo
+        )
+{
+    AACENC_ERROR err;
+    HANDLE_AACENCODER hAacEncoder = NULL;
+    FDK_MEM_INFO *pPrevMemInfo;
+
+    if (pMemInfo==NULL) {
+        return AACENC_INVALID_HANDLE;
+    }
+
+    /* Open and close an instance while accounting its allocations. */
+    pPrevMemInfo = FDKmemMeasure(pMemInfo);
+
+    err = aacEncOpen(&hAacEncoder, encModules, maxChannels);
+    if (hAacEncoder!=NULL) {
+        aacEncClose(&hAacEncoder);
+    }
+
+    FDKmemMeasure(pPrevMemInfo);
+
+    return err;
+}
+
+AACENC_ERROR aacEncoder_GetStats(
+        const HANDLE_AACENCODER   hAacEncoder,
+        FDK_PROF_STATS           *pStats
+        )
+{
+    if ( (hAacEncoder==NULL) || (pStats==NULL) ) {
+        return AACENC_INVALID_HANDLE;
+    }
+
+    FDKmemclear(pStats, sizeof(FDK_PROF_STATS));
+#if defined(FDK_PROFILE)
+    FDKprofileAccumulate(pStats, hAacEncoder->prof, FDK_MAX_WORKERS);
+    return AACENC_OK;
+#else
+    return AACENC_UNSUPPORTED_PARAMETER;
+#endif
+}
+
+AACENC_ERROR aacEncRegisterInputRing(
+        const HANDLE_AACENCODER   hAacEncoder,
+        INT_PCM                  *pRingBuffer,
+        const UINT                ringSize,
+        const UINT                layout
+        )
+{
+    if (hAacEncoder==NULL) {
+        return AACENC_INVALID_HANDLE;
+    }
+    if ( (pRingBuffer!=NULL) && ((ringSize==0) || (layout>1)) ) {
+        return AACENC_INVALID_CONFIG;
+    }
+
+    hAacEncoder->pInputRing       = pRingBuffer;
+    hAacEncoder->inputRingSize    = (pRingBuffer!=NULL) ? (INT)ringSize : 0;
+    hAacEncoder->inputRingLayout  = layout;
+    hAacEncoder->inputRingReadPos = 0;
+    hAacEncoder->inputRingFill    = 0;
+
+    return AACENC_OK;
+}
+
+AACENC_ERROR aacEncRegisterPassStats(
+        const HANDLE_AACENCODER   hAacEncoder,
+        const UCHAR              *pStats,
+        const UINT                statsSize
+        )
+{
+    if (hAacEncoder==NULL) {
+        return AACENC_INVALID_HANDLE;
+    }
+    if ( (pStats!=NULL) && (statsSize==0) ) {
+        return AACENC_INVALID_CONFIG;
+    }
+
+    hAacEncoder->pPassStats    = pStats;
+    hAacEncoder->passStatsSize = (pStats!=NULL) ? statsSize : 0;
+
+    /* restart the second pass */
+    hAacEncoder->InitFlags |= AACENC_INIT_STATES;
+
+    return AACENC_OK;
+}
+
+/**
+ * \brief Check whether the core encoder may read one complete frame directly from client memory.
+ *
+ * This is not possible if a module preprocesses the time signal within the internal input buffer
+ * (SBR, downmix) or needs the interleaved time signal (meta data), or if the input is delayed.
+ *
+ * \param hAacEncoder  Encoder handle.
+ *
+ * \return 1 if in place processing is possible, 0 otherwise.
+ */
+static INT aacEncInPlaceInputAllowed(
+        const HANDLE_AACENCODER   hAacEncoder
+        )
+{
+    if ( (hAacEncoder->nSamplesRead==0)
+      && (hAacEncoder->inputBufferOffset==0)
+      && ((UINT)hAacEncoder->aacConfig.nChannels==hAacEncoder->extParam.nChannels)
+      && !isSbrActive(&hAacEncoder->aacConfig)
+      && !((hAacEncoder->hMetadataEnc!=NULL) && (hAacEncoder->metaDataAllowed!=0))
+      && (hAacEncoder->pLookAheadBuffer==NULL) )
+    {
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * \brief Copy samples from the client ring buffer into the internal, interleaved input buffer.
+ *
+ * \param hAacEncoder  Encoder handle.
+ * \param pOut         Write position in internal input buffer.
+ * \param nSamples     Number of samples to copy, counted over all channels.
+ */
+static void aacEncCopyFromInputRing(
+        HANDLE_AACENCODER   hAacEncoder,
+        INT_PCM            *pOut,
+        INT                 nSamples
+        )
+{
+    const INT_PCM *pRing = hAacEncoder->pInputRing;
+    INT ringSize = hAacEncoder->inputRingSize;
+    INT readPos  = hAacEncoder->inputRingReadPos;
+    INT i;
+
+    if (hAacEncoder->inputRingLayout==0) {
+        INT n = fixMin(nSamples, ringSize-readPos);
+        FDKmemcpy(pOut, pRing+readPos, n*sizeof(INT_PCM));
+        FDKmemcpy(pOut+n, pRing, (nSamples-n)*sizeof(INT_PCM));
+    }
+    else {
+        INT nChannels = hAacEncoder->extParam.nChannels;
+        INT planeSize = ringSize/nChannels;
+        INT ch = readPos%nChannels;
+        INT t  = readPos/nChannels;
+
+        for (i=0; i<nSamples; i++) {
+            pOut[i] = pRing[ch*planeSize + t];
+            if (++ch==nChannels) {
+                ch = 0;
+                if (++t==planeSize) {
+                    t = 0;
+                }
+            }
+        }
+    }
+
+    hAacEncoder->inputRingReadPos = (readPos+nSamples)%ringSize;
+    hAacEncoder->inputRingFill   -= nSamples;
+}
+
+/**
+ * \brief Take input samples from the client ring buffer.
+ *
+ * A complete frame is handed to the core encoder in place if the frame is stored contiguously per
+ * channel and no module needs to modify or delay the time signal within the internal input buffer.
+ * Otherwise the available samples are copied into the internal input buffer.
+ *
+ * \param hAacEncoder  Encoder handle.
+ * \param numInSamples Number of samples newly written into the ring buffer by the client.
+ * \param pNumConsumed Returns number of ring buffer samples released to the client.
+ * \param pInput       Set to the ring buffer frame in case of in place processing.
+ *
+ * \return AACENC_OK on success, AACENC_INVALID_CONFIG if the ring buffer does not fit the configuration.
+ */
+static AACENC_ERROR aacEncFetchInputRing(
+        HANDLE_AACENCODER   hAacEncoder,
+        INT                 numInSamples,
+        INT                *pNumConsumed,
+        PCM_INPUT          *pInput
+        )
+{
+    INT nChannels = hAacEncoder->extParam.nChannels;
+    INT frameSize = hAacEncoder->nSamplesToRead;
+    INT ringSize  = hAacEncoder->inputRingSize;
+    INT newSamples;
+
+    *pNumConsumed = 0;
+
+    if ( (nChannels<1) || (ringSize%nChannels!=0) || (ringSize<frameSize) ) {
+        return AACENC_INVALID_CONFIG;
+    }
+
+    if (numInSamples>0) {
+        if (numInSamples > ringSize-hAacEncoder->inputRingFill) {
+            return AACENC_INVALID_CONFIG; /* client overwrote samples not yet consumed */
+        }
+        hAacEncoder->inputRingFill += numInSamples;
+    }
+
+    /* In place processing of one complete frame. */
+    if ( aacEncInPlaceInputAllowed(hAacEncoder)
+      && (hAacEncoder->inputRingFill>=frameSize)
+      && (ringSize%frameSize==0)
+      && (hAacEncoder->inputRingReadPos%frameSize==0) )
+    {
+        INT ch, readPos = hAacEncoder->inputRingReadPos;
+
+        if (hAacEncoder->inputRingLayout==0) {
+            for (ch=0; ch<nChannels; ch++) {
+                pInput->pChannel[ch] = hAacEncoder->pInputRing + readPos + ch;
+            }
+            pInput->stride = nChannels;
+        }
+        else {
+            for (ch=0; ch<nChannels; ch++) {
+                pInput->pChannel[ch] = hAacEncoder->pInputRing + ch*(ringSize/nChannels) + readPos/nChannels;
+            }
+            pInput->stride = 1;
+        }
+
+        hAacEncoder->inputRingReadPos = (readPos+frameSize)%ringSize;
+        hAacEncoder->inputRingFill   -= frameSize;
+        hAacEncoder->nSamplesRead     = frameSize;
+        *pNumConsumed = frameSize;
+
+        return AACENC_OK;
+    }
+
+    /* Copy into internal input buffer. */
+    newSamples = fixMin(hAacEncoder->inputRingFill, hAacEncoder->nSamplesToRead-hAacEncoder->nSamplesRead);
+
+    if (newSamples>0) {
+        aacEncCopyFromInputRing(hAacEncoder,
+                                hAacEncoder->inputBuffer+hAacEncoder->inputBufferOffset+hAacEncoder->nSamplesRead,
+                                newSamples);
+        hAacEncoder->nSamplesRead += newSamples;
+        *pNumConsumed = newSamples;
+    }
+
+    return AACENC_OK;
+}
+
+/**
+ * \brief Take input samples from planar client buffers, one ::IN_AUDIO_DATA buffer per input channel.
+ *
+ * A complete frame of 16 bit samples is handed to the core encoder in place if possible. Otherwise
+ * the samples are interleaved into the internal input buffer.
+ *
+ * \param hAacEncoder  Encoder handle.
+ * \param inBufDesc    Input buffer descriptor.
+ * \param numInSamples Number of input samples, counted over all channels.
+ * \param pNumConsumed Returns number of consumed input samples, counted over all channels.
+ * \param pInput       Set to the client buffers in case of in place processing.
+ *
+ * \return AACENC_OK on success, AACENC_INVALID_CONFIG if the number of buffers does not match the
+ *         number of input channels.
+ */
+static AACENC_ERROR aacEncFetchPlanarInput(
+        HANDLE_AACENCODER         hAacEncoder,
+        const AACENC_BufDesc     *inBufDesc,
+        INT                       numInSamples,
+        INT                      *pNumConsumed,
+        PCM_INPUT                *pInput
+        )
+{
+    INT nChannels = hAacEncoder->extParam.nChannels;
+    INT bufIdx[(8)];
+    INT i, ch, nBufs = 0;
+
+    *pNumConsumed = 0;
+
+    /* Collect channel buffers in channel order. */
+    for (i=0; i<inBufDesc->numBufs; i++) {
+        if ( (AACENC_BufferIdentifier)inBufDesc->bufferIdentifiers[i] == IN_AUDIO_DATA ) {
+            if (nBufs>=nChannels) {
+                return AACENC_INVALID_CONFIG;
+            }
+            bufIdx[nBufs++] = i;
+        }
+    }
+    if (nBufs!=nChannels) {
+        return AACENC_INVALID_CONFIG;
+    }
+
+    /* In place processing of one complete frame. */
+    if ( aacEncInPlaceInputAllowed(hAacEncoder)
+      && (numInSamples>=hAacEncoder->nSamplesToRead) )
+    {
+        for (ch=0; ch<nChannels; ch++) {
+            if (inBufDesc->bufElSizes[bufIdx[ch]]!=(INT)sizeof(INT_PCM)) {
+                break;
+            }
+        }
+        if (ch==nChannels) {
+            for (ch=0; ch<nChannels; ch++) {
+                pInput->pChannel[ch] = (INT_PCM*)inBufDesc->bufs[bufIdx[ch]];
+            }
+            pInput->stride = 1;
+
+            hAacEncoder->nSamplesRead = hAacEncoder->nSamplesToRead;
+            *pNumConsumed = hAacEncoder->nSamplesToRead;
+
+            return AACENC_OK;
+        }
+    }
+
+    /* Interleave into internal input buffer. */
+    {
+        INT newSamples = fixMax(0,fixMin(numInSamples, hAacEncoder->nSamplesToRead-hAacEncoder->nSamplesRead));
+        INT_PCM *pIn = hAacEncoder->inputBuffer+hAacEncoder->inputBufferOffset+hAacEncoder->nSamplesRead;
+        INT offset = hAacEncoder->nSamplesRead%nChannels;  /* channel of first written sample */
+        INT t = 0;
+
+        ch = offset;
+        for (i=0; i<newSamples; i++) {
+            INT idx = bufIdx[ch];
+            INT pos = (ch<offset) ? t-1 : t;  /* channels before offset start one row later */
+
+            if (inBufDesc->bufElSizes[idx]==(INT)sizeof(INT_PCM)) {
+                pIn[i] = ((INT_PCM*)inBufDesc->bufs[idx])[pos];
+            }
+            else if (inBufDesc->bufElSizes[idx]>(INT)sizeof(INT_PCM)) {
+                pIn[i] = (INT_PCM)(((LONG*)inBufDesc->bufs[idx])[pos]>>16);     /* Convert 32 to 16 bit. */
+            }
+            else {
+                pIn[i] = ((INT_PCM)(((SHORT*)inBufDesc->bufs[idx])[pos]))<<16;  /* Convert 16 to 32 bit. */
+            }
+
+            if (++ch==nChannels) {
+                ch = 0;
+                t++;
+            }
+        }
+        hAacEncoder->nSamplesRead += newSamples;
+        *pNumConsumed = newSamples;
+    }
+
+    return AACENC_OK;
+}
+
 AACENC_ERROR aacEncEncode(
         const HANDLE_AACENCODER   hAacEncoder,
         const AACENC_BufDesc     *inBufDesc,
@@ -1412,6 +1871,10 @@ AACENC_ERROR aacEncEncode(
     INT  outBytes[(1)];
     int  nExtensions = 0;
     int  ancDataExtIdx = -1;
+    PCM_INPUT coreInput;
+#if defined(FDK_PROFILE)
+    FDK_PROF_STATS *pPrevProf = FDKprofileBind((hAacEncoder!=NULL) ? hAacEncoder->prof : NULL);
+#endif
 
     /* deal with valid encoder handle */
     if (hAacEncoder==NULL) {
@@ -1458,10 +1921,41 @@ AACENC_ERROR aacEncEncode(
     /* reset buffer wich signals number of valid bytes in output bitstream buffer */
     FDKmemclear(outBytes, hAacEncoder->aacConfig.nSubFrames*sizeof(INT));
 
+    /* Core encoder reads from internal input buffer by default. */
+    for (i=0; i<hAacEncoder->aacConfig.nChannels; i++) {
+        coreInput.pChannel[i] = hAacEncoder->inputBuffer + i;
+    }
+    coreInput.stride = hAacEncoder->aacConfig.nChannels;
+
     /*
      * Manage incoming audio samples.
      */
-    if ( (inargs->numInSamples > 0) && (getBufDescIdx(inBufDesc,IN_AUDIO_DATA) != -1) )
+    if (hAacEncoder->pInputRing != NULL)
+    {
+        INT numConsumed = 0;
+
+        err = aacEncFetchInputRing(hAacEncoder, inargs->numInSamples, &numConsumed, &coreInput);
+        if (err != AACENC_OK) {
+            goto bail;
+        }
+
+        /* Number of released ring buffer samples. */
+        outargs->numInSamples = numConsumed;
+    }
+    else if ( (inargs->numInSamples > 0) && (getBufDescIdx(inBufDesc,IN_AUDIO_DATA) != -1)
+           && (hAacEncoder->extParam.userInputLayout == 1) )
+    {
+        INT numConsumed = 0;
+
+        err = aacEncFetchPlanarInput(hAacEncoder, inBufDesc, inargs->numInSamples, &numConsumed, &coreInput);
+        if (err != AACENC_OK) {
+            goto bail;
+        }
+
+        /* Number of fetched input buffer samples. */
+        outargs->numInSamples = numConsumed;
+    }
+    else if ( (inargs->numInSamples > 0) && (getBufDescIdx(inBufDesc,IN_AUDIO_DATA) != -1) )
     {
         /* Fetch data until nSamplesToRead reached */
         INT idx = getBufDescIdx(inBufDesc,IN_AUDIO_DATA);
@@ -1572,6 +2066,7 @@ AACENC_ERROR aacEncEncode(
     if ( isSbrActive(&hAacEncoder->aacConfig) ) {
 
         INT nPayload = 0;
+        FDK_PROF_START(tSbr);
 
         /*
          * Encode SBR data.
@@ -1590,6 +2085,7 @@ AACENC_ERROR aacEncEncode(
             goto bail;
         }
         else {
+            FDK_PROF_STOP(FDK_PROF_ENC_SBR, tSbr);
             /* Add SBR extension payload */
             for (i = 0; i < (8); i++) {
                 if (hAacEncoder->extPayloadSize[nPayload][i] > 0) {
@@ -1617,12 +2113,47 @@ AACENC_ERROR aacEncEncode(
         nExtensions++;
     }
 
+    /*
+     * Analyse the new frame ahead and encode the oldest frame of the look-ahead delay line instead.
+     * Placed behind the meta data audio delay, the analysed frames match the encoded ones.
+     */
+    if (hAacEncoder->pLookAheadBuffer!=NULL) {
+        INT_PCM *pIn    = hAacEncoder->inputBuffer+hAacEncoder->inputBufferOffset;
+        INT_PCM *pDelay = hAacEncoder->pLookAheadBuffer+hAacEncoder->lookAheadPos;
+
+        if ( FDKaacEnc_LookAheadFrame( hAacEncoder->hAacEnc,
+                                      &coreInput ) != AAC_ENC_OK )
+        {
+            err = AACENC_ENCODE_ERROR;
+            goto bail;
+        }
+
+        for (i=0; i<hAacEncoder->nSamplesToRead; i++) {
+            INT_PCM tmp = pIn[i];
+            pIn[i] = pDelay[i];
+            pDelay[i] = tmp;
+        }
+        hAacEncoder->lookAheadPos = (hAacEncoder->lookAheadPos+hAacEncoder->nSamplesToRead)%hAacEncoder->lookAheadSize;
+    }
+
     /*
      * Encode AAC - Core.
      */
-    if ( FDKaacEnc_EncodeFrame( hAacEncoder->hAacEnc,
+    if (hAacEncoder->extParam.userPass == 1) {
+        /* First pass: the statistics record of the frame replaces the access unit. */
+        if ( FDKaacEnc_AnalyseFrame( hAacEncoder->hAacEnc,
+                                    &coreInput,
+                                     hAacEncoder->outBuffer,
+                                    &outBytes[0]
+                                   ) != AAC_ENC_OK )
+        {
+            err = AACENC_ENCODE_ERROR;
+            goto bail;
+        }
+    }
+    else if ( FDKaacEnc_EncodeFrame( hAacEncoder->hAacEnc,
                                 hAacEncoder->hTpEnc,
-                                hAacEncoder->inputBuffer,
+                                &coreInput,
                                 outBytes,
                                 hAacEncoder->extPayload
                                 ) != AAC_ENC_OK )
@@ -1677,6 +2208,9 @@ bail:
         /* All encoder modules have to be initialized */
         hAacEncoder->InitFlags = AACENC_INIT_ALL;
     }
+#if defined(FDK_PROFILE)
+    FDKprofileBind(pPrevProf);
+#endif
 
     return err;
 }
@@ -1712,6 +2246,346 @@ AAC_ENCODER_ERROR aacEncGetConf(HANDLE_AACENCODER  hAacEncoder,
       return AAC_ENC_OK;
 }
 
+/* shared context of the segment jobs of aacEncEncodeSegments() */
+typedef struct {
+    HANDLE_AACENCODER   hTemplate;
+    const INT_PCM      *pInput;
+    UINT                numInSamples;
+    AACENC_SEGMENT     *pSegments;
+    UINT                numSegments;
+    INT                 frameSize;       /* input samples of all channels per access unit */
+    INT                 preRollFrames;   /* frames to prime a segment encoder */
+    INT                 maxOutBytes;     /* maximum size of one access unit */
+} AACENC_SEGMENT_JOBS;
+
+/* encode one segment on an own encoder instance */
+static AACENC_ERROR aacEncEncodeSegment(
+        const AACENC_SEGMENT_JOBS *pJobs,
+        AACENC_SEGMENT            *pSeg,
+        const INT                  isLastSegment,
+        const INT                  workerIdx
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+    HANDLE_AACENCODER hAacEncoder = NULL;
+    HANDLE_AACENCODER hTemplate = pJobs->hTemplate;
+    UCHAR *pAu = NULL;
+    INT preRoll = fixMin((INT)pSeg->startFrame, pJobs->preRollFrames);
+    INT frame = (INT)pSeg->startFrame - preRoll;
+    INT endFrame = (INT)(pSeg->startFrame + pSeg->numFrames);
+    UINT inPos = (UINT)frame * pJobs->frameSize;
+
+    pSeg->numOutBytes = 0;
+    pSeg->numAus = 0;
+
+    pAu = (UCHAR*)FDKcalloc(pJobs->maxOutBytes, sizeof(UCHAR));
+    if (pAu == NULL) {
+        err = AACENC_MEMORY_ERROR;
+        goto bail;
+    }
+
+    err = aacEncOpen(&hAacEncoder, hTemplate->encoder_modis, hTemplate->nMaxAacChannels | (hTemplate->nMaxSbrChannels<<8));
+    if (err != AACENC_OK) {
+        goto bail;
+    }
+
+    /* same parameter set as the template, segments already run in parallel */
+    hAacEncoder->extParam = hTemplate->extParam;
+    hAacEncoder->extParam.userNumThreads = 1;
+    hAacEncoder->extParam.userInputLayout = 0;
+    hAacEncoder->InitFlags = AACENC_INIT_ALL;
+
+    err = aacEncEncode(hAacEncoder, NULL, NULL, NULL, NULL);
+    if (err != AACENC_OK) {
+        goto bail;
+    }
+
+    for (; isLastSegment || (frame < endFrame); frame++)
+    {
+        AACENC_BufDesc inBufDesc, outBufDesc;
+        AACENC_InArgs  inargs;
+        AACENC_OutArgs outargs;
+        void *pInBuf = (void*)(pJobs->pInput + inPos), *pOutBuf = pAu;
+        INT inId = IN_AUDIO_DATA, inSize, inElSize = sizeof(INT_PCM);
+        INT outId = OUT_BITSTREAM_DATA, outSize = pJobs->maxOutBytes, outElSize = sizeof(UCHAR);
+
+        FDKmemclear(&inargs, sizeof(AACENC_InArgs));
+        FDKmemclear(&outargs, sizeof(AACENC_OutArgs));
+
+        /* flush the encoder after the end of the input */
+        inargs.numInSamples = (inPos < pJobs->numInSamples) ? (INT)fixMin((UINT)pJobs->frameSize, pJobs->numInSamples-inPos) : -1;
+        inSize = fixMax(0, inargs.numInSamples) * sizeof(INT_PCM);
+
+        inBufDesc.numBufs = 1;
+        inBufDesc.bufs = &pInBuf;
+        inBufDesc.bufferIdentifiers = &inId;
+        inBufDesc.bufSizes = &inSize;
+        inBufDesc.bufElSizes = &inElSize;
+
+        outBufDesc.numBufs = 1;
+        outBufDesc.bufs = &pOutBuf;
+        outBufDesc.bufferIdentifiers = &outId;
+        outBufDesc.bufSizes = &outSize;
+        outBufDesc.bufElSizes = &outElSize;
+
+        /* the bit reservoir is empty at every segment boundary */
+        if ( (preRoll > 0) && (frame == (INT)pSeg->startFrame) ) {
+            FDKaacEnc_BitResHandoff(hAacEncoder->hAacEnc, BITRES_HANDOFF_START);
+        }
+        if ( !isLastSegment && (frame == endFrame-1) ) {
+            FDKaacEnc_BitResHandoff(hAacEncoder->hAacEnc, BITRES_HANDOFF_END);
+        }
+
+        err = aacEncEncode(hAacEncoder, &inBufDesc, &outBufDesc, &inargs, &outargs);
+
+        FDKaacEnc_BitResHandoff(hAacEncoder->hAacEnc, BITRES_HANDOFF_NONE);
+
+        if (err == AACENC_ENCODE_EOF) {
+            err = AACENC_OK;
+            break;
+        }
+        if (err != AACENC_OK) {
+            goto bail;
+        }
+
+        inPos += outargs.numInSamples;
+
+        /* keep the access units of the segment, drop the priming ones */
+        if ( (outargs.numOutBytes > 0) && (frame >= (INT)pSeg->startFrame) ) {
+            if ( (pSeg->numOutBytes + outargs.numOutBytes > pSeg->outBufSize)
+              || ((pSeg->pAuSizes != NULL) && (pSeg->numAus >= pSeg->maxAus)) )
+            {
+                err = AACENC_ENCODE_ERROR;
+                goto bail;
+            }
+            FDKmemcpy(pSeg->pOutBuf + pSeg->numOutBytes, pAu, outargs.numOutBytes);
+            if (pSeg->pAuSizes != NULL) {
+                pSeg->pAuSizes[pSeg->numAus] = outargs.numOutBytes;
+            }
+            pSeg->numOutBytes += outargs.numOutBytes;
+            pSeg->numAus++;
+        }
+    }
+
+bail:
+#if defined(FDK_PROFILE)
+    /* account the segment instance to the worker of the template */
+    if (hAacEncoder != NULL) {
+        FDKprofileAccumulate(&hTemplate->prof[workerIdx], hAacEncoder->prof, FDK_MAX_WORKERS);
+    }
+#endif
+    aacEncClose(&hAacEncoder);
+    if (pAu != NULL) {
+        FDKfree(pAu);
+    }
+    return err;
+}
+
+static void aacEncEncodeSegmentJob(void *pCtx, INT jobIdx, INT workerIdx)
+{
+    AACENC_SEGMENT_JOBS *pJobs = (AACENC_SEGMENT_JOBS*)pCtx;
+
+    pJobs->pSegments[jobIdx].err = aacEncEncodeSegment(pJobs, &pJobs->pSegments[jobIdx], (jobIdx == (INT)pJobs->numSegments-1), workerIdx);
+}
+
+AACENC_ERROR aacEncEncodeSegments(
+        const HANDLE_AACENCODER   hAacEncoder,
+        const INT_PCM            *pInput,
+        const UINT                numInSamples,
+        AACENC_SEGMENT           *pSegments,
+        const UINT                numSegments,
+        const UINT                numThreads
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+    AACENC_SEGMENT_JOBS jobs;
+    HANDLE_FDK_WORKERPOOL hPool = NULL;
+    UINT i;
+
+    if (hAacEncoder==NULL) {
+        err = AACENC_INVALID_HANDLE;
+        goto bail;
+    }
+
+    /* template must be initialized, without meta data */
+    if ( (hAacEncoder->InitFlags != 0) || (hAacEncoder->hAacEnc == NULL) || (hAacEncoder->extParam.userMetaDataMode != 0)
+      || (hAacEncoder->extParam.userPass != 0)
+      || (pInput == NULL) || (pSegments == NULL) || (numSegments == 0) )
+    {
+        err = AACENC_INVALID_CONFIG;
+        goto bail;
+    }
+
+    jobs.hTemplate     = hAacEncoder;
+    jobs.pInput        = pInput;
+    jobs.numInSamples  = numInSamples;
+    jobs.pSegments     = pSegments;
+    jobs.numSegments   = numSegments;
+    jobs.frameSize     = hAacEncoder->nSamplesToRead;
+    /* cover the encoder delay and one more frame of filterbank overlap and psychoacoustic history */
+    jobs.preRollFrames = (hAacEncoder->nDelay + jobs.frameSize - 1) / jobs.frameSize + 1;
+    jobs.maxOutBytes   = ((hAacEncoder->nMaxAacChannels*6144)+7)>>3;
+
+    if ( (numInSamples % hAacEncoder->extParam.nChannels) != 0 ) {
+        err = AACENC_INVALID_CONFIG;
+        goto bail;
+    }
+
+    /* contiguous segments starting at frame 0, all but the last one within the input,
+       the last one runs up to the end of the input */
+    for (i=0; i<numSegments; i++) {
+        UINT start = (i==0) ? 0 : pSegments[i-1].startFrame + pSegments[i-1].numFrames;
+
+        if ( (pSegments[i].startFrame != start)
+          || ((i == numSegments-1) && (pSegments[i].numFrames != 0))
+          || ((i < numSegments-1) && ((pSegments[i].numFrames == 0)
+                                   || ((pSegments[i].startFrame + pSegments[i].numFrames) * (UINT)jobs.frameSize > numInSamples))) )
+        {
+            err = AACENC_INVALID_CONFIG;
+            goto bail;
+        }
+        pSegments[i].err = AACENC_OK;
+    }
+
+    if (FDKworkerPoolOpen(&hPool, fixMin((INT)fixMin(numThreads, numSegments), FDK_MAX_WORKERS)) != 0) {
+        err = AACENC_MEMORY_ERROR;
+        goto bail;
+    }
+
+    FDKworkerPoolRun(hPool, aacEncEncodeSegmentJob, &jobs, numSegments);
+
+    FDKworkerPoolClose(&hPool);
+
+    for (i=0; i<numSegments; i++) {
+        if (pSegments[i].err != AACENC_OK) {
+            err = pSegments[i].err;
+            break;
+        }
+    }
+
+bail:
+    return err;
+}
+
+/* encode one clip from a clean encoder state, including the flushed access units */
+static AACENC_ERROR aacEncEncodeClip(
+        HANDLE_AACENCODER          hAacEncoder,
+        AACENC_CLIP               *pClip
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+    INT maxOutBytes = ((hAacEncoder->nMaxAacChannels*6144)+7)>>3;
+    UINT inPos = 0;
+
+    pClip->numOutBytes = 0;
+    pClip->numAus = 0;
+
+    if ( (pClip->pInput == NULL) || (pClip->pOutBuf == NULL)
+      || ((pClip->numInSamples % hAacEncoder->extParam.nChannels) != 0) )
+    {
+        return AACENC_INVALID_CONFIG;
+    }
+
+    /* start a new stream, keep the configuration */
+    hAacEncoder->InitFlags |= AACENC_INIT_STATES | AACENC_INIT_TRANSPORT | AACENC_RESET_INBUFFER;
+    hAacEncoder->nSamplesRead = 0;
+
+    err = aacEncEncode(hAacEncoder, NULL, NULL, NULL, NULL);
+    if (err != AACENC_OK) {
+        return err;
+    }
+
+    for (;;)
+    {
+        AACENC_BufDesc inBufDesc, outBufDesc;
+        AACENC_InArgs  inargs;
+        AACENC_OutArgs outargs;
+        void *pInBuf = (void*)(pClip->pInput + inPos), *pOutBuf = pClip->pOutBuf + pClip->numOutBytes;
+        INT inId = IN_AUDIO_DATA, inSize, inElSize = sizeof(INT_PCM);
+        INT outId = OUT_BITSTREAM_DATA, outSize, outElSize = sizeof(UCHAR);
+
+        FDKmemclear(&inargs, sizeof(AACENC_InArgs));
+        FDKmemclear(&outargs, sizeof(AACENC_OutArgs));
+
+        /* flush the encoder after the end of the clip */
+        inargs.numInSamples = (inPos < pClip->numInSamples) ? (INT)fixMin((UINT)hAacEncoder->nSamplesToRead, pClip->numInSamples-inPos) : -1;
+        inSize = fixMax(0, inargs.numInSamples) * sizeof(INT_PCM);
+
+        /* access units are written to the clip output buffer in place */
+        outSize = (INT)fixMin((UINT)maxOutBytes, pClip->outBufSize - pClip->numOutBytes);
+
+        inBufDesc.numBufs = 1;
+        inBufDesc.bufs = &pInBuf;
+        inBufDesc.bufferIdentifiers = &inId;
+        inBufDesc.bufSizes = &inSize;
+        inBufDesc.bufElSizes = &inElSize;
+
+        outBufDesc.numBufs = 1;
+        outBufDesc.bufs = &pOutBuf;
+        outBufDesc.bufferIdentifiers = &outId;
+        outBufDesc.bufSizes = &outSize;
+        outBufDesc.bufElSizes = &outElSize;
+
+        err = aacEncEncode(hAacEncoder, &inBufDesc, &outBufDesc, &inargs, &outargs);
+
+        if (err == AACENC_ENCODE_EOF) {
+            err = AACENC_OK;
+            break;
+        }
+        if (err != AACENC_OK) {
+            break;
+        }
+
+        inPos += outargs.numInSamples;
+
+        if (outargs.numOutBytes > 0) {
+            if (pClip->pAuSizes != NULL) {
+                if (pClip->numAus >= pClip->maxAus) {
+                    err = AACENC_ENCODE_ERROR;
+                    break;
+                }
+                pClip->pAuSizes[pClip->numAus] = outargs.numOutBytes;
+            }
+            pClip->numOutBytes += outargs.numOutBytes;
+            pClip->numAus++;
+        }
+    }
+
+    return err;
+}
+
+AACENC_ERROR aacEncEncodeClips(
+        const HANDLE_AACENCODER   hAacEncoder,
+        AACENC_CLIP              *pClips,
+        const UINT                numClips
+        )
+{
+    AACENC_ERROR err = AACENC_OK;
+    UINT i;
+
+    if (hAacEncoder==NULL) {
+        return AACENC_INVALID_HANDLE;
+    }
+
+    /* clips are passed as interleaved memory buffers */
+    if ( (hAacEncoder->pInputRing != NULL) || (hAacEncoder->extParam.userInputLayout != 0)
+      || (hAacEncoder->extParam.userPass != 0)
+      || (pClips == NULL) || (numClips == 0) )
+    {
+        return AACENC_INVALID_CONFIG;
+    }
+
+    for (i=0; i<numClips; i++) {
+        pClips[i].err = aacEncEncodeClip(hAacEncoder, &pClips[i]);
+
+        if ( (pClips[i].err != AACENC_OK) && (err == AACENC_OK) ) {
+            err = pClips[i].err;
+        }
+    }
+
+    return err;
+}
+
 
 AACENC_ERROR aacEncGetLibInfo(LIB_INFO *info)
 {
@@ -1884,6 +2758,36 @@ AACENC_ERROR aacEncoder_SetParam(
             hAacEncoder->InitFlags |= AACENC_INIT_CONFIG;
         }
         break;
+    case AACENC_COMPLEXITY:
+        if (settings->userComplexity != value) {
+            if (value > ENC_COMPLEXITY_FASTEST) {
+                err = AACENC_INVALID_CONFIG;
+                break;
+            }
+            settings->userComplexity = value;
+            hAacEncoder->InitFlags |= AACENC_INIT_CONFIG;
+        }
+        break;
+    case AACENC_LOOKAHEAD:
+        if (settings->userLookAhead != value) {
+            if (value > AACENC_MAX_LOOKAHEAD) {
+                err = AACENC_INVALID_CONFIG;
+                break;
+            }
+            settings->userLookAhead = value;
+            hAacEncoder->InitFlags |= AACENC_INIT_CONFIG | AACENC_INIT_STATES;
+        }
+        break;
+    case AACENC_PASS:
+        if (settings->userPass != value) {
+            if (value > 2) {
+                err = AACENC_INVALID_CONFIG;
+                break;
+            }
+            settings->userPass = value;
+            hAacEncoder->InitFlags |= AACENC_INIT_CONFIG | AACENC_INIT_STATES;
+        }
+        break;
     case AACENC_GRANULE_LENGTH:
         if (settings->userFramelength != value) {
           switch (value) {
@@ -2005,6 +2909,25 @@ AACENC_ERROR aacEncoder_SetParam(
             hAacEncoder->InitFlags |= AACENC_INIT_CONFIG;
         }
         break;
+    case AACENC_NUM_THREADS:
+        if ((UINT)settings->userNumThreads != value) {
+            if (value > FDK_MAX_WORKERS) {
+                err = AACENC_INVALID_CONFIG;
+                break;
+            }
+            settings->userNumThreads = value;
+            hAacEncoder->InitFlags |= AACENC_INIT_CONFIG;
+        }
+        break;
+    case AACENC_INPUT_LAYOUT:
+        if ((UINT)settings->userInputLayout != value) {
+            if (! ((value==0) || (value==1)) ) {
+                err = AACENC_INVALID_CONFIG;
+                break;
+            }
+            settings->userInputLayout = value;
+        }
+        break;
     case AACENC_PEAK_BITRATE:
         if (settings->userPeakBitrate != value) {
             settings->userPeakBitrate = value;
@@ -2060,6 +2983,15 @@ UINT aacEncoder_GetParam(
     case AACENC_AFTERBURNER:
         value = (UINT)hAacEncoder->aacConfig.useRequant;
         break;
+    case AACENC_COMPLEXITY:
+        value = (UINT)hAacEncoder->aacConfig.complexity;
+        break;
+    case AACENC_LOOKAHEAD:
+        value = (UINT)hAacEncoder->aacConfig.lookAhead;
+        break;
+    case AACENC_PASS:
+        value = (UINT)settings->userPass;
+        break;
     case AACENC_GRANULE_LENGTH:
         value = (UINT)hAacEncoder->aacConfig.framelength;
        break;
@@ -2096,6 +3028,12 @@ UINT aacEncoder_GetParam(
     case AACENC_METADATA_MODE:
         value = (hAacEncoder->metaDataAllowed==0) ? 0 : (UINT)settings->userMetaDataMode;
         break;
+    case AACENC_NUM_THREADS:
+        value = (UINT)FDKworkerPoolGetWorkers(hAacEncoder->hAacEnc->hWorkerPool);
+        break;
+    case AACENC_INPUT_LAYOUT:
+        value = (UINT)settings->userInputLayout;
+        break;
     case AACENC_PEAK_BITRATE:
         value = (UINT)-1; /* peak bitrate parameter is meaningless */
         if ( ((INT)hAacEncoder->extParam.userPeakBitrate!=-1) ) {
@@ -358,7 +358,8 @@ AAC_ENCODER_ERROR FDKaacEnc_InitTnsConfiguration(INT bitRate,
                                                  TNS_CONFIG *tC,
                                                  PSY_CONFIGURATION *pC,
                                                  INT active,
-                                                 INT useTnsPeak)
+                                                 INT useTnsPeak,
+                                                 INT reducedSearch)
 {
   int i;
   //float acfTimeRes   = (blockType == SHORT_WINDOW) ? 0.125f : 0.046875f;
@@ -453,6 +454,15 @@ AAC_ENCODER_ERROR FDKaacEnc_InitTnsConfiguration(INT bitRate,
       tC->tnsActive = FALSE; /* no configuration available, disable tns tool */
   }
 
+  if (reducedSearch) {
+    /* one filter of limited order */
+    tC->maxOrder = FDKmin(tC->maxOrder, TNS_MAX_ORDER_REDUCED);
+    for (i = 0; i < MAX_NUM_OF_FILTERS; i++) {
+      tC->confTab.tnsLimitOrder[i] = FDKmin(tC->confTab.tnsLimitOrder[i], tC->maxOrder);
+    }
+    tC->confTab.seperateFiltersAllowed = 0;
+  }
+
   return AAC_ENC_OK;
 
 }
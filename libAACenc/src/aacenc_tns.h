@@ -108,12 +108,18 @@ amm-info@iis.fraunhofer.de
  *   tnsMask |= 0x2; activate TNS for long blocks
  *   tnsMask |= 0x4; activate TNS PEAK tool for short blocks
  *   tnsMask |= 0x8; activate TNS PEAK tool for long blocks
+ * TNS_REDUCED_SEARCH_MASK
+ *   tnsMask |= 0x10; search only one filter of reduced order
  */
 #define TNS_ENABLE_MASK 0xf
+#define TNS_REDUCED_SEARCH_MASK 0x10
 
 /* TNS max filter order for Low Complexity MPEG4 profile */
 #define TNS_MAX_ORDER 12
 
+/* TNS max filter order of the reduced filter search */
+#define TNS_MAX_ORDER_REDUCED 8
+
 
 #define MAX_NUM_OF_FILTERS 2
 
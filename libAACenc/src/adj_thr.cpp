@@ -2165,9 +2165,30 @@ static FIXP_DBL FDKaacEnc_bitresCalcBitFac(const INT       bitresBits,
         bresParam->clipSpendLow, bresParam->clipSpendHigh,
         bresParam->minBitSpend, bresParam->maxBitSpend, bitspend_slope);
 
-    pe_pers = (pex > adjThrChan->peMin) ? fDivNorm(pex - adjThrChan->peMin, adjThrChan->peMax - adjThrChan->peMin) : 0;
-    tmp_fix = fMult(((FIXP_DBL)bitSpend + (FIXP_DBL)bitSave), pe_pers);
-    bitresFac_fix = (UNITY>>1) - ((FIXP_DBL)bitSave>>1) + (tmp_fix>>1); qbres = (DFRACT_BITS-2);
+    if (adjThrChan->passBitFac > 0)
+    {
+        /* bits planned over the whole signal by the second pass of two-pass encoding,
+           limited by the actual bitreservoir fill level only */
+        bitresFac_fix = (FIXP_DBL)adjThrChan->passBitFac << (DFRACT_BITS-2-PASS_BITFAC_Q);
+    }
+    else if (adjThrChan->peLookAhead > 0)
+    {
+        /* spend bits in proportion to the pe of this frame relative to the mean pe of the
+           look-ahead window, within the limits given by the bitreservoir fill level */
+        INT qpe;
+
+        pex = fixMin(pe, adjThrChan->peLookAhead + (adjThrChan->peLookAhead>>1));
+        bitresFac_fix = (pex > 0) ? scaleValue(fDivNorm(pex, adjThrChan->peLookAhead, &qpe), qpe-1) : (FIXP_DBL)0;
+        bitresFac_fix = fixMax(bitresFac_fix, (UNITY>>1) - ((FIXP_DBL)bitSave>>1));
+        bitresFac_fix = fixMin(bitresFac_fix, (UNITY>>1) + ((FIXP_DBL)bitSpend>>1));
+    }
+    else
+    {
+        pe_pers = (pex > adjThrChan->peMin) ? fDivNorm(pex - adjThrChan->peMin, adjThrChan->peMax - adjThrChan->peMin) : 0;
+        tmp_fix = fMult(((FIXP_DBL)bitSpend + (FIXP_DBL)bitSave), pe_pers);
+        bitresFac_fix = (UNITY>>1) - ((FIXP_DBL)bitSave>>1) + (tmp_fix>>1);
+    }
+    qbres = (DFRACT_BITS-2);
 
     /* (float)bitresBits/(float)avgBits */
     bits_ratio = fDivNorm(bitresBits, avgBits, &qbr);
@@ -2256,7 +2277,7 @@ void FDKaacEnc_AdjThrInit(
         const INT       dZoneQuantEnable
         )
 {
-  INT i;
+  INT i, ch;
 
   FIXP_DBL POINT8 = FL2FXCONST_DBL(0.8f);
   FIXP_DBL POINT6 = FL2FXCONST_DBL(0.6f);
@@ -2294,6 +2315,8 @@ void FDKaacEnc_AdjThrInit(
     /* parameters for bitres control */
     atsElem->peMin = fMultI(POINT8, meanPe) >> 1;
     atsElem->peMax = fMultI(POINT6, meanPe);
+    atsElem->peLookAhead = 0;
+    atsElem->passBitFac  = 0;
 
     /* for use in FDKaacEnc_reduceThresholdsVBR */
     atsElem->chaosMeasureOld = FL2FXCONST_DBL(0.3f);
@@ -2339,6 +2362,12 @@ void FDKaacEnc_AdjThrInit(
     atsElem->dynBitsLast = -1;
     atsElem->peLast = 0;
 
+    /* init threshold weighting */
+    for (ch=0; ch<(2); ch++) {
+      atsElem->chaosMeasureEnFac[ch] = FL2FXCONST_DBL(0.f);
+      atsElem->lastEnFacPatch[ch] = FALSE;
+    }
+
     /* init bits to pe factor */
 
     /* init bits2PeFactor */
@@ -114,9 +114,15 @@ typedef struct {
   FIXP_DBL redOffs;
 } MINSNR_ADAPT_PARAM;
 
+#define PASS_BITFAC_Q  (10)   /* fractional bits of the planned bit factor of two-pass encoding */
+
 typedef struct {
   /* parameters for bitreservoir control */
   INT peMin, peMax;
+  /* mean pe of the look-ahead window, 0 if not available */
+  INT peLookAhead;
+  /* bits planned by the second pass relative to the average bits in Q(PASS_BITFAC_Q), 0 if not available */
+  INT passBitFac;
   /* constant offset to pe               */
   INT    peOffset;
   /* constant PeFactor */
@@ -95,6 +95,27 @@ amm-info@iis.fraunhofer.de
 #define HI_LTAB(a) (a>>16)
 #define LO_LTAB(a) (a & 0xffff)
 
+/*****************************************************************************
+
+    functionname: FDKaacEnc_addPackedBitCount
+    description:  adds packed bit counts of tables firstBook-11
+    returns:
+    input:        packed bit counts, see HUFF_LTAB_PACK
+    output:       bitCount for tables firstBook-11
+
+*****************************************************************************/
+
+static inline void FDKaacEnc_addPackedBitCount(const UINT64 bc7_11,
+                                               const INT    firstBook,
+                                               INT         *bitCount)
+{
+  INT book;
+
+  for (book=firstBook; book<=11; book++) {
+    bitCount[book] += HUFF_LTAB_UNPACK(bc7_11,book);
+  }
+}
+
 /*****************************************************************************
 
 
@@ -111,50 +132,51 @@ static void FDKaacEnc_count1_2_3_4_5_6_7_8_9_10_11(const SHORT *RESTRICT values,
                                          INT       *bitCount)
 {
 
-  INT i;
-  INT bc1_2,bc3_4,bc5_6,bc7_8,bc9_10,bc11,sc;
+  INT i,end;
+  INT bc1_2,bc3_4,bc5_6,sc;
   INT t0,t1,t2,t3;
+  UINT64 bc7_11;
   bc1_2=0;
   bc3_4=0;
   bc5_6=0;
-  bc7_8=0;
-  bc9_10=0;
-  bc11=0;
   sc=0;
+  bitCount[7]=bitCount[8]=bitCount[9]=bitCount[10]=bitCount[11]=0;
 
-  for(i=0;i<width;i+=4){
+  for(i=0;i<width;){
+    bc7_11=0;
+    end=fixMin(i+HUFF_LTAB_PACK_LINES,width);
 
-    t0= values[i+0];
-    t1= values[i+1];
-    t2= values[i+2];
-    t3= values[i+3];
+    for(;i<end;i+=4){
 
-    /* 1,2 */
+      t0= values[i+0];
+      t1= values[i+1];
+      t2= values[i+2];
+      t3= values[i+3];
 
-    bc1_2+=FDKaacEnc_huff_ltab1_2[t0+1][t1+1][t2+1][t3+1];
+      /* 1,2 */
 
-    /* 5,6 */
-    bc5_6+=FDKaacEnc_huff_ltab5_6[t0+4][t1+4];
-    bc5_6+=FDKaacEnc_huff_ltab5_6[t2+4][t3+4];
+      bc1_2+=FDKaacEnc_huff_ltab1_2[t0+1][t1+1][t2+1][t3+1];
 
-    t0=fixp_abs(t0);
-    t1=fixp_abs(t1);
-    t2=fixp_abs(t2);
-    t3=fixp_abs(t3);
+      /* 5,6 */
+      bc5_6+=FDKaacEnc_huff_ltab5_6[t0+4][t1+4];
+      bc5_6+=FDKaacEnc_huff_ltab5_6[t2+4][t3+4];
 
+      t0=fixp_abs(t0);
+      t1=fixp_abs(t1);
+      t2=fixp_abs(t2);
+      t3=fixp_abs(t3);
 
-    bc3_4+= FDKaacEnc_huff_ltab3_4[t0][t1][t2][t3];
 
-    bc7_8+=FDKaacEnc_huff_ltab7_8[t0][t1];
-    bc7_8+=FDKaacEnc_huff_ltab7_8[t2][t3];
+      bc3_4+= FDKaacEnc_huff_ltab3_4[t0][t1][t2][t3];
 
-    bc9_10+=FDKaacEnc_huff_ltab9_10[t0][t1];
-    bc9_10+=FDKaacEnc_huff_ltab9_10[t2][t3];
+      /* 7-11 */
+      bc7_11+=FDKaacEnc_huff_ltab7_11[t0][t1];
+      bc7_11+=FDKaacEnc_huff_ltab7_11[t2][t3];
 
-    bc11+= (INT) FDKaacEnc_huff_ltab11[t0][t1];
-    bc11+= (INT) FDKaacEnc_huff_ltab11[t2][t3];
+      sc+=(t0>0)+(t1>0)+(t2>0)+(t3>0);
+    }
 
-    sc+=(t0>0)+(t1>0)+(t2>0)+(t3>0);
+    FDKaacEnc_addPackedBitCount(bc7_11,7,bitCount);
   }
 
   bitCount[1]=HI_LTAB(bc1_2);
@@ -163,11 +185,6 @@ static void FDKaacEnc_count1_2_3_4_5_6_7_8_9_10_11(const SHORT *RESTRICT values,
   bitCount[4]=LO_LTAB(bc3_4)+sc;
   bitCount[5]=HI_LTAB(bc5_6);
   bitCount[6]=LO_LTAB(bc5_6);
-  bitCount[7]=HI_LTAB(bc7_8)+sc;
-  bitCount[8]=LO_LTAB(bc7_8)+sc;
-  bitCount[9]=HI_LTAB(bc9_10)+sc;
-  bitCount[10]=LO_LTAB(bc9_10)+sc;
-  bitCount[11]=bc11+sc;
 
 }
 
@@ -187,44 +204,44 @@ static void FDKaacEnc_count3_4_5_6_7_8_9_10_11(const SHORT *RESTRICT values,
                                      INT       *bitCount)
 {
 
-  INT i;
-  INT bc3_4,bc5_6,bc7_8,bc9_10,bc11,sc;
+  INT i,end;
+  INT bc3_4,bc5_6,sc;
   INT t0,t1,t2,t3;
+  UINT64 bc7_11;
 
   bc3_4=0;
   bc5_6=0;
-  bc7_8=0;
-  bc9_10=0;
-  bc11=0;
   sc=0;
+  bitCount[7]=bitCount[8]=bitCount[9]=bitCount[10]=bitCount[11]=0;
 
-  for(i=0;i<width;i+=4){
+  for(i=0;i<width;){
+    bc7_11=0;
+    end=fixMin(i+HUFF_LTAB_PACK_LINES,width);
 
-    t0= values[i+0];
-    t1= values[i+1];
-    t2= values[i+2];
-    t3= values[i+3];
+    for(;i<end;i+=4){
 
-    bc5_6+=FDKaacEnc_huff_ltab5_6[t0+4][t1+4];
-    bc5_6+=FDKaacEnc_huff_ltab5_6[t2+4][t3+4];
+      t0= values[i+0];
+      t1= values[i+1];
+      t2= values[i+2];
+      t3= values[i+3];
 
-    t0=fixp_abs(t0);
-    t1=fixp_abs(t1);
-    t2=fixp_abs(t2);
-    t3=fixp_abs(t3);
+      bc5_6+=FDKaacEnc_huff_ltab5_6[t0+4][t1+4];
+      bc5_6+=FDKaacEnc_huff_ltab5_6[t2+4][t3+4];
 
-    bc3_4+= FDKaacEnc_huff_ltab3_4[t0][t1][t2][t3];
+      t0=fixp_abs(t0);
+      t1=fixp_abs(t1);
+      t2=fixp_abs(t2);
+      t3=fixp_abs(t3);
 
-    bc7_8+=FDKaacEnc_huff_ltab7_8[t0][t1];
-    bc7_8+=FDKaacEnc_huff_ltab7_8[t2][t3];
+      bc3_4+= FDKaacEnc_huff_ltab3_4[t0][t1][t2][t3];
 
-    bc9_10+=FDKaacEnc_huff_ltab9_10[t0][t1];
-    bc9_10+=FDKaacEnc_huff_ltab9_10[t2][t3];
+      bc7_11+=FDKaacEnc_huff_ltab7_11[t0][t1];
+      bc7_11+=FDKaacEnc_huff_ltab7_11[t2][t3];
 
-    bc11+= (INT) FDKaacEnc_huff_ltab11[t0][t1];
-    bc11+= (INT) FDKaacEnc_huff_ltab11[t2][t3];
+      sc+=(t0>0)+(t1>0)+(t2>0)+(t3>0);
+    }
 
-    sc+=(t0>0)+(t1>0)+(t2>0)+(t3>0);
+    FDKaacEnc_addPackedBitCount(bc7_11,7,bitCount);
   }
 
   bitCount[1]=INVALID_BITCOUNT;
@@ -233,11 +250,6 @@ static void FDKaacEnc_count3_4_5_6_7_8_9_10_11(const SHORT *RESTRICT values,
   bitCount[4]=LO_LTAB(bc3_4)+sc;
   bitCount[5]=HI_LTAB(bc5_6);
   bitCount[6]=LO_LTAB(bc5_6);
-  bitCount[7]=HI_LTAB(bc7_8)+sc;
-  bitCount[8]=LO_LTAB(bc7_8)+sc;
-  bitCount[9]=HI_LTAB(bc9_10)+sc;
-  bitCount[10]=LO_LTAB(bc9_10)+sc;
-  bitCount[11]=bc11+sc;
 }
 
 
@@ -258,30 +270,28 @@ static void FDKaacEnc_count5_6_7_8_9_10_11(const SHORT *RESTRICT values,
                                  INT       *bitCount)
 {
 
-  INT i;
-  INT bc5_6,bc7_8,bc9_10,bc11,sc;
+  INT i,end;
+  INT bc5_6;
   INT t0,t1;
+  UINT64 bc7_11;
   bc5_6=0;
-  bc7_8=0;
-  bc9_10=0;
-  bc11=0;
-  sc=0;
+  bitCount[7]=bitCount[8]=bitCount[9]=bitCount[10]=bitCount[11]=0;
 
-  for(i=0;i<width;i+=2){
+  for(i=0;i<width;){
+    bc7_11=0;
+    end=fixMin(i+HUFF_LTAB_PACK_LINES,width);
 
-    t0 = values[i+0];
-    t1 = values[i+1];
+    for(;i<end;i+=2){
 
-    bc5_6+=FDKaacEnc_huff_ltab5_6[t0+4][t1+4];
+      t0 = values[i+0];
+      t1 = values[i+1];
 
-    t0=fixp_abs(t0);
-    t1=fixp_abs(t1);
+      bc5_6+=FDKaacEnc_huff_ltab5_6[t0+4][t1+4];
 
-    bc7_8+=FDKaacEnc_huff_ltab7_8[t0][t1];
-    bc9_10+=FDKaacEnc_huff_ltab9_10[t0][t1];
-    bc11+= (INT) FDKaacEnc_huff_ltab11[t0][t1];
+      bc7_11+=FDKaacEnc_huff_ltab7_11[fixp_abs(t0)][fixp_abs(t1)];
+    }
 
-    sc+=(t0>0)+(t1>0);
+    FDKaacEnc_addPackedBitCount(bc7_11,7,bitCount);
   }
   bitCount[1]=INVALID_BITCOUNT;
   bitCount[2]=INVALID_BITCOUNT;
@@ -289,61 +299,65 @@ static void FDKaacEnc_count5_6_7_8_9_10_11(const SHORT *RESTRICT values,
   bitCount[4]=INVALID_BITCOUNT;
   bitCount[5]=HI_LTAB(bc5_6);
   bitCount[6]=LO_LTAB(bc5_6);
-  bitCount[7]=HI_LTAB(bc7_8)+sc;
-  bitCount[8]=LO_LTAB(bc7_8)+sc;
-  bitCount[9]=HI_LTAB(bc9_10)+sc;
-  bitCount[10]=LO_LTAB(bc9_10)+sc;
-  bitCount[11]=bc11+sc;
 
 }
 
 
 /*****************************************************************************
 
-    functionname: FDKaacEnc_count7_8_9_10_11
-    description:  counts tables 7-11
+    functionname: FDKaacEnc_count7_11
+    description:  counts tables firstBook-11, firstBook >= 7,
+                  all tables in one pass with packed code lengths
     returns:
     input:        quantized spectrum
-    output:       bitCount for tables 7-11
+    output:       bitCount for tables firstBook-11
 
 *****************************************************************************/
 
-static void FDKaacEnc_count7_8_9_10_11(const SHORT *RESTRICT values,
-                             const INT  width,
-                             INT       *bitCount)
+static inline void FDKaacEnc_count7_11(const SHORT *RESTRICT values,
+                                       const INT  width,
+                                       const INT  firstBook,
+                                       INT       *bitCount)
 {
 
-  INT i;
-  INT bc7_8,bc9_10,bc11,sc;
-  INT t0,t1;
+  INT i,end;
+  UINT64 bc7_11;
 
-  bc7_8=0;
-  bc9_10=0;
-  bc11=0;
-  sc=0;
+  for(i=firstBook;i<=11;i++){
+    bitCount[i]=0;
+  }
+
+  for(i=0;i<width;){
+    bc7_11=0;
+    end=fixMin(i+HUFF_LTAB_PACK_LINES,width);
 
-  for(i=0;i<width;i+=2){
-    t0=fixp_abs(values[i+0]);
-    t1=fixp_abs(values[i+1]);
+    for(;i<end;i+=2){
+      bc7_11+=FDKaacEnc_huff_ltab7_11[fixp_abs(values[i+0])][fixp_abs(values[i+1])];
+    }
 
-    bc7_8+=FDKaacEnc_huff_ltab7_8[t0][t1];
-    bc9_10+=FDKaacEnc_huff_ltab9_10[t0][t1];
-    bc11+= (INT) FDKaacEnc_huff_ltab11[t0][t1];
-    sc+=(t0>0)+(t1>0);
+    FDKaacEnc_addPackedBitCount(bc7_11,firstBook,bitCount);
   }
 
-  bitCount[1]=INVALID_BITCOUNT;
-  bitCount[2]=INVALID_BITCOUNT;
-  bitCount[3]=INVALID_BITCOUNT;
-  bitCount[4]=INVALID_BITCOUNT;
-  bitCount[5]=INVALID_BITCOUNT;
-  bitCount[6]=INVALID_BITCOUNT;
-  bitCount[7]=HI_LTAB(bc7_8)+sc;
-  bitCount[8]=LO_LTAB(bc7_8)+sc;
-  bitCount[9]=HI_LTAB(bc9_10)+sc;
-  bitCount[10]=LO_LTAB(bc9_10)+sc;
-  bitCount[11]=bc11+sc;
+  for(i=1;i<firstBook;i++){
+    bitCount[i]=INVALID_BITCOUNT;
+  }
+}
+
+/*****************************************************************************
+
+    functionname: FDKaacEnc_count7_8_9_10_11
+    description:  counts tables 7-11
+    returns:
+    input:        quantized spectrum
+    output:       bitCount for tables 7-11
+
+*****************************************************************************/
 
+static void FDKaacEnc_count7_8_9_10_11(const SHORT *RESTRICT values,
+                             const INT  width,
+                             INT       *bitCount)
+{
+  FDKaacEnc_count7_11(values,width,7,bitCount);
 }
 
 /*****************************************************************************
@@ -362,37 +376,7 @@ static void FDKaacEnc_count9_10_11(const SHORT *RESTRICT values,
                          const INT  width,
                          INT       *bitCount)
 {
-
-  INT i;
-  INT bc9_10,bc11,sc;
-  INT t0,t1;
-
-  bc9_10=0;
-  bc11=0;
-  sc=0;
-
-  for(i=0;i<width;i+=2){
-    t0=fixp_abs(values[i+0]);
-    t1=fixp_abs(values[i+1]);
-
-    bc9_10+=FDKaacEnc_huff_ltab9_10[t0][t1];
-    bc11+= (INT) FDKaacEnc_huff_ltab11[t0][t1];
-
-    sc+=(t0>0)+(t1>0);
-  }
-
-  bitCount[1]=INVALID_BITCOUNT;
-  bitCount[2]=INVALID_BITCOUNT;
-  bitCount[3]=INVALID_BITCOUNT;
-  bitCount[4]=INVALID_BITCOUNT;
-  bitCount[5]=INVALID_BITCOUNT;
-  bitCount[6]=INVALID_BITCOUNT;
-  bitCount[7]=INVALID_BITCOUNT;
-  bitCount[8]=INVALID_BITCOUNT;
-  bitCount[9]=HI_LTAB(bc9_10)+sc;
-  bitCount[10]=LO_LTAB(bc9_10)+sc;
-  bitCount[11]=bc11+sc;
-
+  FDKaacEnc_count7_11(values,width,9,bitCount);
 }
 
 /*****************************************************************************
@@ -409,31 +393,7 @@ static void FDKaacEnc_count11(const SHORT *RESTRICT values,
                     const INT  width,
                     INT        *bitCount)
 {
-
-  INT i;
-  INT bc11,sc;
-  INT t0,t1;
-
-  bc11=0;
-  sc=0;
-  for(i=0;i<width;i+=2){
-    t0=fixp_abs(values[i+0]);
-    t1=fixp_abs(values[i+1]);
-    bc11+= (INT) FDKaacEnc_huff_ltab11[t0][t1];
-    sc+=(t0>0)+(t1>0);
-  }
-
-  bitCount[1]=INVALID_BITCOUNT;
-  bitCount[2]=INVALID_BITCOUNT;
-  bitCount[3]=INVALID_BITCOUNT;
-  bitCount[4]=INVALID_BITCOUNT;
-  bitCount[5]=INVALID_BITCOUNT;
-  bitCount[6]=INVALID_BITCOUNT;
-  bitCount[7]=INVALID_BITCOUNT;
-  bitCount[8]=INVALID_BITCOUNT;
-  bitCount[9]=INVALID_BITCOUNT;
-  bitCount[10]=INVALID_BITCOUNT;
-  bitCount[11]=bc11+sc;
+  FDKaacEnc_count7_11(values,width,11,bitCount);
 }
 
 /*****************************************************************************
@@ -451,40 +411,44 @@ static void FDKaacEnc_countEsc(const SHORT *RESTRICT values,
                      INT       *RESTRICT bitCount)
 {
 
-  INT i;
-  INT bc11,ec,sc;
-  INT t0,t1,t00,t01;
+  INT i,end;
+  INT bc11,ec;
+  INT t0,t1;
+  UINT64 bc7_11;
 
   bc11=0;
-  sc=0;
   ec=0;
-  for(i=0;i<width;i+=2){
-    t0=fixp_abs(values[i+0]);
-    t1=fixp_abs(values[i+1]);
+  for(i=0;i<width;){
+    bc7_11=0;
+    end=fixMin(i+HUFF_LTAB_PACK_LINES,width);
 
-    sc+=(t0>0)+(t1>0);
+    for(;i<end;i+=2){
+      t0=fixp_abs(values[i+0]);
+      t1=fixp_abs(values[i+1]);
 
-    t00 = fixMin(t0,16);
-    t01 = fixMin(t1,16);
-    bc11+= (INT) FDKaacEnc_huff_ltab11[t00][t01];
+      /* codebook 11 and sign bits */
+      bc7_11+=FDKaacEnc_huff_ltab7_11[fixMin(t0,16)][fixMin(t1,16)];
 
-    if(t0>=16){
-      ec+=5;
-      while((t0>>=1) >= 16)
-        ec+=2;
-    }
+      if(t0>=16){
+        ec+=5;
+        while((t0>>=1) >= 16)
+          ec+=2;
+      }
 
-    if(t1>=16){
-      ec+=5;
-      while((t1>>=1) >= 16)
-        ec+=2;
+      if(t1>=16){
+        ec+=5;
+        while((t1>>=1) >= 16)
+          ec+=2;
+      }
     }
+
+    bc11+=HUFF_LTAB_UNPACK(bc7_11,11);
   }
 
   for (i=0; i<11; i++)
     bitCount[i]=INVALID_BITCOUNT;
 
-  bitCount[11]=bc11+sc+ec;
+  bitCount[11]=bc11+ec;
 }
 
 
@@ -854,8 +818,7 @@ INT FDKaacEnc_codeValues(SHORT *RESTRICT values, INT width, INT codeBook,  HANDL
 
       codeWord   = FDKaacEnc_huff_ctab3[t0][t1][t2][t3];
       codeLength = HI_LTAB(FDKaacEnc_huff_ltab3_4[t0][t1][t2][t3]);
-      FDKwriteBits(hBitstream,codeWord,codeLength);
-      FDKwriteBits(hBitstream,sign,signLength);
+      FDKwriteBits(hBitstream,(codeWord<<signLength)|sign,codeLength+signLength);
     }
     break;
 
@@ -901,8 +864,7 @@ INT FDKaacEnc_codeValues(SHORT *RESTRICT values, INT width, INT codeBook,  HANDL
       }
       codeWord   = FDKaacEnc_huff_ctab4[t0][t1][t2][t3];
       codeLength = LO_LTAB(FDKaacEnc_huff_ltab3_4[t0][t1][t2][t3]);
-      FDKwriteBits(hBitstream,codeWord,codeLength);
-      FDKwriteBits(hBitstream,sign,signLength);
+      FDKwriteBits(hBitstream,(codeWord<<signLength)|sign,codeLength+signLength);
     }
     break;
 
@@ -951,8 +913,7 @@ INT FDKaacEnc_codeValues(SHORT *RESTRICT values, INT width, INT codeBook,  HANDL
       }
       codeWord   = FDKaacEnc_huff_ctab7[t0][t1];
       codeLength = HI_LTAB(FDKaacEnc_huff_ltab7_8[t0][t1]);
-      FDKwriteBits(hBitstream,codeWord,codeLength);
-      FDKwriteBits(hBitstream,sign,signLength);
+      FDKwriteBits(hBitstream,(codeWord<<signLength)|sign,codeLength+signLength);
     }
     break;
 
@@ -981,8 +942,7 @@ INT FDKaacEnc_codeValues(SHORT *RESTRICT values, INT width, INT codeBook,  HANDL
       }
       codeWord   = FDKaacEnc_huff_ctab8[t0][t1];
       codeLength = LO_LTAB(FDKaacEnc_huff_ltab7_8[t0][t1]);
-      FDKwriteBits(hBitstream,codeWord,codeLength);
-      FDKwriteBits(hBitstream,sign,signLength);
+      FDKwriteBits(hBitstream,(codeWord<<signLength)|sign,codeLength+signLength);
     }
     break;
 
@@ -1010,8 +970,7 @@ INT FDKaacEnc_codeValues(SHORT *RESTRICT values, INT width, INT codeBook,  HANDL
       }
       codeWord   = FDKaacEnc_huff_ctab9[t0][t1];
       codeLength = HI_LTAB(FDKaacEnc_huff_ltab9_10[t0][t1]);
-      FDKwriteBits(hBitstream,codeWord,codeLength);
-      FDKwriteBits(hBitstream,sign,signLength);
+      FDKwriteBits(hBitstream,(codeWord<<signLength)|sign,codeLength+signLength);
     }
     break;
 
@@ -1040,8 +999,7 @@ INT FDKaacEnc_codeValues(SHORT *RESTRICT values, INT width, INT codeBook,  HANDL
       }
       codeWord   = FDKaacEnc_huff_ctab10[t0][t1];
       codeLength = LO_LTAB(FDKaacEnc_huff_ltab9_10[t0][t1]);
-      FDKwriteBits(hBitstream,codeWord,codeLength);
-      FDKwriteBits(hBitstream,sign,signLength);
+      FDKwriteBits(hBitstream,(codeWord<<signLength)|sign,codeLength+signLength);
     }
     break;
 
@@ -1072,29 +1030,26 @@ INT FDKaacEnc_codeValues(SHORT *RESTRICT values, INT width, INT codeBook,  HANDL
 
       codeWord   = FDKaacEnc_huff_ctab11[t00][t01];
       codeLength = (INT) FDKaacEnc_huff_ltab11[t00][t01];
-      FDKwriteBits(hBitstream,codeWord,codeLength);
-      FDKwriteBits(hBitstream,sign,signLength);
+      FDKwriteBits(hBitstream,(codeWord<<signLength)|sign,codeLength+signLength);
       if(t0 >=16){
         INT n,p;
         n=0;
         p=t0;
         while((p>>=1) >=16){
-          FDKwriteBits(hBitstream,1,1);
           n++;
         }
-        FDKwriteBits(hBitstream,0,1);
-        FDKwriteBits(hBitstream,t0-(1<<(n+4)),n+4);
+        /* escape prefix (n ones and a zero) and escape word in one write */
+        FDKwriteBits(hBitstream,(((1<<(n+1))-2)<<(n+4))|(t0-(1<<(n+4))),2*n+5);
       }
       if(t1 >=16){
         INT n,p;
         n=0;
         p=t1;
         while((p>>=1) >=16){
-          FDKwriteBits(hBitstream,1,1);
           n++;
         }
-        FDKwriteBits(hBitstream,0,1);
-        FDKwriteBits(hBitstream,t1-(1<<(n+4)),n+4);
+        /* escape prefix (n ones and a zero) and escape word in one write */
+        FDKwriteBits(hBitstream,(((1<<(n+1))-2)<<(n+4))|(t1-(1<<(n+4))),2*n+5);
       }
     }
     break;
@@ -122,7 +122,9 @@ static void FDKaacEnc_buildBitLookUp(
         const INT* const          sfbOffset,
         const UINT* const         sfbMax,
         INT                       bitLookUp[MAX_SFB_LONG][CODE_BOOK_ESC_NDX + 1],
-        SECTION_INFO* const       huffsection
+        SECTION_INFO* const       huffsection,
+        SFB_RATE_CACHE* const     rateCache,
+        const INT                 grpNdx
         )
 {
   INT i, sfbWidth;
@@ -134,7 +136,18 @@ static void FDKaacEnc_buildBitLookUp(
     huffsection[i].sectionBits = INVALID_BITCOUNT;
     huffsection[i].codeBook = -1;
     sfbWidth = sfbOffset[i + 1] - sfbOffset[i];
-    FDKaacEnc_bitCount(quantSpectrum + sfbOffset[i], sfbWidth, sfbMax[i], bitLookUp[i]);
+
+    if (rateCache == NULL) {
+      FDKaacEnc_bitCount(quantSpectrum + sfbOffset[i], sfbWidth, sfbMax[i], bitLookUp[i]);
+    }
+    else {
+      /* band unchanged since last count: reuse it */
+      if (rateCache->countGain[grpNdx+i] != rateCache->quantGain[grpNdx+i]) {
+        FDKaacEnc_bitCount(quantSpectrum + sfbOffset[i], sfbWidth, sfbMax[i], rateCache->bitLookUp[grpNdx+i]);
+        rateCache->countGain[grpNdx+i] = rateCache->quantGain[grpNdx+i];
+      }
+      FDKmemcpy(bitLookUp[i], rateCache->bitLookUp[grpNdx+i], sizeof(bitLookUp[i]));
+    }
   }
 }
 
@@ -385,6 +398,47 @@ FDKaacEnc_gmStage2(
   }
 }
 
+/*
+   sectioning Stage 2, reduced complexity: merge each section with its successor
+   as long as this saves bits, single pass from low to high frequencies
+ */
+static void
+FDKaacEnc_gmStage2Fast(
+        SECTION_INFO* const RESTRICT huffsection,
+        INT                          bitLookUp[MAX_SFB_LONG][CODE_BOOK_ESC_NDX + 1],
+        const INT                    maxSfb,
+        const SHORT* const           sideInfoTab,
+        const INT                    useVCB11
+        )
+{
+  INT i = 0;
+
+  while (i + huffsection[i].sfbCnt < maxSfb)
+  {
+    INT next = i + huffsection[i].sfbCnt;
+    INT mergeGain = FDKaacEnc_CalcMergeGain(huffsection,
+                                            bitLookUp,
+                                            sideInfoTab,
+                                            i,
+                                            next,
+                                            useVCB11);
+
+    if (mergeGain > 0)
+    {
+      huffsection[i].sfbCnt += huffsection[next].sfbCnt;
+      huffsection[i].sectionBits += huffsection[next].sectionBits - mergeGain;
+
+      FDKaacEnc_mergeBitLookUp(bitLookUp[i], bitLookUp[next]);
+
+      huffsection[i + huffsection[i].sfbCnt - 1].sfbStart = huffsection[i].sfbStart;
+    }
+    else
+    {
+      i = next;
+    }
+  }
+}
+
 /* count bits used by the noiseless coder */
 static void FDKaacEnc_noiselessCounter(
         SECTION_DATA* const RESTRICT sectionData,
@@ -396,7 +450,9 @@ static void FDKaacEnc_noiselessCounter(
         const INT                    blockType,
         const INT* const             noiseNrg,
         const INT* const             isBook,
-        const INT                    useVCB11
+        const INT                    useVCB11,
+        const INT                    fastSectioning,
+        SFB_RATE_CACHE* const        rateCache
         )
 {
   INT grpNdx, i;
@@ -435,7 +491,9 @@ static void FDKaacEnc_noiselessCounter(
                    sfbOffset + grpNdx,
                    maxValueInSfb + grpNdx,
                    bitLookUp,
-                   huffsection);
+                   huffsection,
+                   rateCache,
+                   grpNdx);
 
     /* 0.Stage :Find minimum Codebooks */
     FDKaacEnc_gmStage0(huffsection, bitLookUp, sectionData->maxSfbPerGroup, noiseNrg+grpNdx, isBook+grpNdx);
@@ -450,12 +508,21 @@ static void FDKaacEnc_noiselessCounter(
        gain until no more gain is possible
      */
 
-    FDKaacEnc_gmStage2(huffsection,
-             mergeGainLookUp,
-             bitLookUp,
-             sectionData->maxSfbPerGroup,
-             sideInfoTab,
-             useVCB11);
+    if (fastSectioning) {
+      FDKaacEnc_gmStage2Fast(huffsection,
+               bitLookUp,
+               sectionData->maxSfbPerGroup,
+               sideInfoTab,
+               useVCB11);
+    }
+    else {
+      FDKaacEnc_gmStage2(huffsection,
+               mergeGainLookUp,
+               bitLookUp,
+               sectionData->maxSfbPerGroup,
+               sideInfoTab,
+               useVCB11);
+    }
 
 
 
@@ -723,6 +790,16 @@ static void FDKaacEnc_noiseCount(
   }
 }
 
+void FDKaacEnc_resetRateCache(SFB_RATE_CACHE* const rateCache)
+{
+  INT i;
+
+  for (i = 0; i < MAX_GROUPED_SFB; i++) {
+    rateCache->quantGain[i] = SFB_RATE_CACHE_INVALID;
+    rateCache->countGain[i] = SFB_RATE_CACHE_INVALID;
+  }
+}
+
 INT FDKaacEnc_dynBitCount(
         BITCNTR_STATE* const         hBC,
         const SHORT* const           quantSpectrum,
@@ -737,7 +814,8 @@ INT FDKaacEnc_dynBitCount(
         const INT* const             noiseNrg,
         const INT* const             isBook,
         const INT* const             isScale,
-        const UINT                   syntaxFlags
+        const UINT                   syntaxFlags,
+        SFB_RATE_CACHE* const        rateCache
         )
 {
   sectionData->blockType      = blockType;
@@ -756,7 +834,9 @@ INT FDKaacEnc_dynBitCount(
                    blockType,
                    noiseNrg,
                    isBook,
-                   (syntaxFlags & AC_ER_VCB11)?1:0);
+                   (syntaxFlags & AC_ER_VCB11)?1:0,
+                   hBC->fastSectioning,
+                   rateCache);
 
   FDKaacEnc_scfCount(
            scalefac,
@@ -784,6 +864,7 @@ INT FDKaacEnc_BCNew(BITCNTR_STATE **phBC
     *phBC = hBC;
     hBC->bitLookUp       = GetRam_aacEnc_BitLookUp(0,dynamic_RAM);
     hBC->mergeGainLookUp = GetRam_aacEnc_MergeGainLookUp(0,dynamic_RAM);
+    hBC->fastSectioning  = 0;
     if (hBC->bitLookUp       == 0 ||
         hBC->mergeGainLookUp == 0)
     {
@@ -95,6 +95,7 @@ amm-info@iis.fraunhofer.de
 
 #include "psy_const.h"
 #include "aacenc_tns.h"
+#include "bit_cnt.h"
 
 #define MAX_SECTIONS          MAX_GROUPED_SFB
 #define SECT_ESC_VAL_LONG    31
@@ -129,11 +130,26 @@ typedef struct
   INT firstScf;                 /* first scf to be coded */
 } SECTION_DATA;
 
+#define SFB_RATE_CACHE_INVALID  ((INT)0x7FFFFFFF)
+
+/* Per band memo of the quantization and bit count inside the QC loop of one frame.
+   A band whose quantization gain did not change since its last count, or which
+   was quantized to zero with a smaller gain, is neither quantized nor counted again. */
+typedef struct
+{
+  INT quantGain[MAX_GROUPED_SFB];   /* gain the quantized band was computed with */
+  INT countGain[MAX_GROUPED_SFB];   /* gain the bitLookUp row belongs to         */
+  INT bitLookUp[MAX_GROUPED_SFB][CODE_BOOK_ESC_NDX + 1];
+} SFB_RATE_CACHE;
+
+void FDKaacEnc_resetRateCache(SFB_RATE_CACHE* const rateCache);
+
 
 struct BITCNTR_STATE
 {
   INT *bitLookUp;
   INT *mergeGainLookUp;
+  INT fastSectioning;           /* merge sections in a single pass instead of the greedy search */
 };
 
 
@@ -161,7 +177,8 @@ INT FDKaacEnc_dynBitCount(
         const INT* const             noiseNrg,
         const INT* const             isBook,
         const INT* const             isScale,
-        const UINT                   syntaxFlags
+        const UINT                   syntaxFlags,
+        SFB_RATE_CACHE* const        rateCache
         );
 
 #endif
@@ -231,6 +231,9 @@ AAC_ENCODER_ERROR FDKaacEnc_psyInitStates(PSY_INTERNAL    *hPsy,
   /* init input buffer */
   FDKmemclear(psyStatic->psyInputBuffer, MAX_INPUT_BUFFER_SIZE*sizeof(INT_PCM));
 
+  /* init low delay filterbank overlap */
+  FDKmemclear(psyStatic->overlapAddBuffer, sizeof(psyStatic->overlapAddBuffer));
+
   FDKaacEnc_InitBlockSwitching(&psyStatic->blockSwitchingControl,
                                 isLowDelay(audioObjectType)
                                );
@@ -347,7 +350,8 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMainInit(PSY_INTERNAL *hPsy,
        &(hPsy->psyConf[0].tnsConf),
        &hPsy->psyConf[0],
         (INT)(tnsMask&2),
-        (INT)(tnsMask&8) );
+        (INT)(tnsMask&8),
+        (INT)(tnsMask&TNS_REDUCED_SEARCH_MASK) );
 
   if (ErrorStatus != AAC_ENC_OK)
     return ErrorStatus;
@@ -368,7 +372,8 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMainInit(PSY_INTERNAL *hPsy,
            &hPsy->psyConf[1].tnsConf,
            &hPsy->psyConf[1],
             (INT)(tnsMask&1),
-            (INT)(tnsMask&4) );
+            (INT)(tnsMask&4),
+            (INT)(tnsMask&TNS_REDUCED_SEARCH_MASK) );
 
     if (ErrorStatus != AAC_ENC_OK)
     return ErrorStatus;
@@ -421,6 +426,11 @@ void FDKaacEnc_deinterleaveInputBuffer(INT_PCM *pOutputSamples,
                                        INT nChannels)
 {
     INT k;
+    if (nChannels==1) {
+        /* planar input samples */
+        FDKmemcpy(pOutputSamples, pInputSamples, nSamples*sizeof(INT_PCM));
+        return;
+    }
     /* deinterlave input samples and write to output buffer */
     for (k=0; k<nSamples; k++) {
         pOutputSamples[k] = pInputSamples[k*nChannels];
@@ -444,9 +454,8 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
                                     PSY_DYNAMIC        *psyDynamic,
                                     PSY_CONFIGURATION  *psyConf,
                                     PSY_OUT_ELEMENT    *RESTRICT psyOutElement,
-                                    INT_PCM             *pInput,
-                                    INT                 *chIdx,
-                                    INT                  totalChannels
+                                    const PCM_INPUT     *pInput,
+                                    INT                 *chIdx
                                    )
 {
     const INT commonWindow = 1;
@@ -510,13 +519,18 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
 
       for(ch = 0; ch < channels; ch++)
       {
-          C_ALLOC_SCRATCH_START(pTimeSignal, INT_PCM, (1024))
-
-          /* deinterleave input data and use for block switching */
-          FDKaacEnc_deinterleaveInputBuffer( pTimeSignal,
-                                            &pInput[chIdx[ch]],
-                                             psyConf->granuleLength,
-                                             totalChannels);
+          C_ALLOC_SCRATCH_START(pTimeSignalBuf, INT_PCM, (1024))
+          INT_PCM *pTimeSignal = pInput->pChannel[chIdx[ch]];
+
+          if (pInput->stride != 1) {
+            /* deinterleave input data and use for block switching */
+            FDKaacEnc_deinterleaveInputBuffer( pTimeSignalBuf,
+                                               pTimeSignal,
+                                               psyConf->granuleLength,
+                                               pInput->stride);
+            pTimeSignal = pTimeSignalBuf;
+          }
+          /* else: planar input data is used for block switching directly */
 
 
           FDKaacEnc_BlockSwitching (&psyStatic[ch]->blockSwitchingControl,
@@ -531,7 +545,7 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
                       pTimeSignal,
                       (2*psyConf->granuleLength-blockSwitchingOffset)*sizeof(INT_PCM));
 
-            C_ALLOC_SCRATCH_END(pTimeSignal, INT_PCM, (1024))
+            C_ALLOC_SCRATCH_END(pTimeSignalBuf, INT_PCM, (1024))
       }
 
       /* synch left and right block type */
@@ -550,9 +564,9 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
       {
         /* deinterleave input data and use for block switching */
         FDKaacEnc_deinterleaveInputBuffer( psyStatic[ch]->psyInputBuffer + blockSwitchingOffset,
-                                          &pInput[chIdx[ch]],
+                                           pInput->pChannel[chIdx[ch]],
                                            psyConf->granuleLength,
-                                           totalChannels);
+                                           pInput->stride);
       }
     }
 
@@ -651,9 +665,9 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
 
         /* ... and get remaining samples from input buffer */
         FDKaacEnc_deinterleaveInputBuffer( psyStatic[ch]->psyInputBuffer+psyConf->granuleLength,
-                                          &pInput[ (2*psyConf->granuleLength-blockSwitchingOffset)*totalChannels + chIdx[ch] ],
+                                           pInput->pChannel[chIdx[ch]] + (2*psyConf->granuleLength-blockSwitchingOffset)*pInput->stride,
                                            blockSwitchingOffset-psyConf->granuleLength,
-                                           totalChannels);
+                                           pInput->stride);
 
     } /* ch */
 
@@ -788,6 +802,7 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
             INT tnsActive[TRANS_FAC];
             INT nrgScaling[2] = {0,0};
             INT tnsSpecShift = 0;
+            FDK_PROF_START(tTns);
 
             for(ch = 0; ch < channels; ch++) {
                 for(w = 0; w < nWindows[ch]; w++) {
@@ -923,6 +938,7 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
               }
             } /* end channel loop */
 
+            FDK_PROF_STOP(FDK_PROF_ENC_TNS, tTns);
         } /* TNS active */
     }  /* !isLFE */
 
@@ -163,9 +163,8 @@ AAC_ENCODER_ERROR FDKaacEnc_psyMain(INT                 channels,
                                     PSY_DYNAMIC         *psyDynamic,
                                     PSY_CONFIGURATION   *psyConf,
                                     PSY_OUT_ELEMENT     *psyOutElement,
-                                    INT_PCM             *pInput,
-                                    INT                 *chIdx,
-                                    INT                  totalChannels
+                                    const PCM_INPUT     *pInput,
+                                    INT                 *chIdx
                                    );
 
 void FDKaacEnc_PsyClose(PSY_INTERNAL   **phPsyInternal,
@@ -98,6 +98,7 @@ amm-info@iis.fraunhofer.de
 #include "line_pe.h"
 #include "FDK_audio.h"
 #include "interface.h"
+#include "FDK_thread.h"
 
 
 typedef enum {
@@ -149,7 +150,8 @@ struct QC_INIT{
   QCDATA_BR_MODE bitrateMode;
   INT meanPe;
   INT chBitrate;
-  INT invQuant;
+  INT invQuant;      /* afterburner level, 0: off */
+  INT fastSectioning; /* merge sections in a single pass */
   INT maxIterations; /* Maximum number of allowed iterations before FDKaacEnc_crashRecovery() is applied. */
   FIXP_DBL maxBitFac;
   INT bitrate;
@@ -169,6 +171,7 @@ typedef struct
   INT           scf[MAX_GROUPED_SFB];
   INT           globalGain;
   SECTION_DATA  sectionData;
+  SFB_RATE_CACHE rateCache;
 
   FIXP_DBL      sfbFormFactorLdData[MAX_GROUPED_SFB];
 
@@ -257,6 +260,7 @@ typedef struct
   INT bitDistributionMode; /* 0: full bitreservoir, 1: reduced bitreservoir, 2: disabled bitreservoir */
   INT bitResTot;
   INT bitResTotMax;
+  INT bitResDrain;        /* spend the whole bit reservoir in the current frame */
   INT maxIterations;      /* Maximum number of allowed iterations before FDKaacEnc_crashRecovery() is applied. */
   INT invQuant;
 
@@ -271,6 +275,8 @@ typedef struct
 
   INT dZoneQuantEnable;   /* enable dead zone quantizer */
 
+  HANDLE_FDK_WORKERPOOL hWorkerPool; /* element-parallel processing, owned by AAC_ENC */
+
 } QC_STATE;
 
 #endif /* _QC_DATA_H */
@@ -372,9 +372,11 @@ AAC_ENCODER_ERROR FDKaacEnc_QCInit(QC_STATE *hQC,
   hQC->nElements       = init->channelMapping->nElements;
   hQC->bitResTotMax    = init->bitRes;
   hQC->bitResTot       = init->bitRes;
+  hQC->bitResDrain     = 0;
   hQC->maxBitFac       = init->maxBitFac;
   hQC->bitrateMode     = init->bitrateMode;
   hQC->invQuant        = init->invQuant;
+  hQC->hBitCounter->fastSectioning = init->fastSectioning;
   hQC->maxIterations   = init->maxIterations;
 
   if ( isConstantBitrateMode(hQC->bitrateMode) ) {
@@ -743,7 +745,7 @@ static INT FDKaacEnc_getTotalConsumedBits(QC_OUT**          qcOut,
     return totalUsedBits;
 }
 
-static AAC_ENCODER_ERROR FDKaacEnc_BitResRedistribution(
+AAC_ENCODER_ERROR FDKaacEnc_BitResRedistribution(
         QC_STATE *const              hQC,
         const CHANNEL_MAPPING *const cm,
         const INT                    avgTotalBits
@@ -787,6 +789,30 @@ static AAC_ENCODER_ERROR FDKaacEnc_BitResRedistribution(
 }
 
 
+/* Element-parallel scalefactor estimation of FDKaacEnc_QCMain(). */
+typedef struct {
+  QC_STATE         *hQC;
+  PSY_OUT          *psyOut;
+  QC_OUT_ELEMENT  **qcElement;
+  CHANNEL_MAPPING  *cm;
+} ESTIMATE_SF_JOB;
+
+static void FDKaacEnc_EstimateScaleFactorsJob(void *pCtx, INT i, INT worker)
+{
+  ESTIMATE_SF_JOB *job = (ESTIMATE_SF_JOB*)pCtx;
+  ELEMENT_INFO elInfo = job->cm->elInfo[i];
+
+  if ((elInfo.elType == ID_SCE) || (elInfo.elType == ID_CPE) ||
+      (elInfo.elType == ID_LFE))
+  {
+      FDKaacEnc_EstimateScaleFactors(job->psyOut->psyOutElement[i]->psyOutChannel,
+                                     job->qcElement[i]->qcOutChannel,
+                                     job->hQC->invQuant,
+                                     job->hQC->dZoneQuantEnable,
+                                     elInfo.nChannelsInEl);
+  }
+}
+
 AAC_ENCODER_ERROR FDKaacEnc_QCMain(QC_STATE* RESTRICT         hQC,
                                    PSY_OUT**                  psyOut,
                                    QC_OUT**                   qcOut,
@@ -904,6 +930,17 @@ AAC_ENCODER_ERROR FDKaacEnc_QCMain(QC_STATE* RESTRICT         hQC,
       /* for ( all sub frames ) ... */
       for (c = 0 ; c < nSubFrames ; c++ )
       {
+          ESTIMATE_SF_JOB sfJob;
+
+          /* Turn thresholds into scalefactors, optimize bit consumption and verify conformance.
+             Thresholds are final at this point, so all elements can be processed in parallel. */
+          sfJob.hQC       = hQC;
+          sfJob.psyOut    = psyOut[c];
+          sfJob.qcElement = qcElement[c];
+          sfJob.cm        = cm;
+
+          FDKworkerPoolRun(hQC->hWorkerPool, FDKaacEnc_EstimateScaleFactorsJob, &sfJob, cm->nElements);
+
           for (i=0; i<cm->nElements; i++)
           {
               ELEMENT_INFO elInfo = cm->elInfo[i];
@@ -912,14 +949,6 @@ AAC_ENCODER_ERROR FDKaacEnc_QCMain(QC_STATE* RESTRICT         hQC,
               if ((elInfo.elType == ID_SCE) || (elInfo.elType == ID_CPE) ||
                   (elInfo.elType == ID_LFE))
               {
-                      /* Turn thresholds into scalefactors, optimize bit consumption and verify conformance */
-                      FDKaacEnc_EstimateScaleFactors(psyOut[c]->psyOutElement[i]->psyOutChannel,
-                                            qcElement[c][i]->qcOutChannel,
-                                            hQC->invQuant,
-                                            hQC->dZoneQuantEnable,
-                                            cm->elInfo[i].nChannelsInEl);
-
-
                       /*-------------------------------------------- */
                       constraintsFulfilled[c][i] = 1;
                       iterations[c][i] = 0 ;
@@ -928,6 +957,8 @@ AAC_ENCODER_ERROR FDKaacEnc_QCMain(QC_STATE* RESTRICT         hQC,
                       {
                           chConstraintsFulfilled[c][i][ch] = 1;
                           calculateQuant[c][i][ch] = 1;
+                          /* quantSpec was used by the scalefactor estimation */
+                          FDKaacEnc_resetRateCache(&qcElement[c][i]->qcOutChannel[ch]->rateCache);
                       }
 
                       /*-------------------------------------------- */
@@ -1012,7 +1043,9 @@ AAC_ENCODER_ERROR FDKaacEnc_QCMain(QC_STATE* RESTRICT         hQC,
                                                              qcOutCh->globalGain,
                                                              qcOutCh->scf,
                                                              qcOutCh->quantSpec,
-                                                             hQC->dZoneQuantEnable);
+                                                             hQC->dZoneQuantEnable,
+                                                             qcOutCh->maxValueInSfb,
+                                                             qcOutCh->rateCache.quantGain);
 
                                   /*-------------------------------------------- */
                                   if (FDKaacEnc_calcMaxValueInSfb(psyOutCh->sfbCnt,
@@ -1066,7 +1099,8 @@ AAC_ENCODER_ERROR FDKaacEnc_QCMain(QC_STATE* RESTRICT         hQC,
                                                                 psyOutCh->noiseNrg,
                                                                 psyOutCh->isBook,
                                                                 psyOutCh->isScale,
-                                                                syntaxFlags) ;
+                                                                syntaxFlags,
+                                                                &qcOutCh->rateCache) ;
 
                           /* sum up dynamic channel bits */
                           qcElement[c][i]->dynBitsUsed += chDynBits;
@@ -1272,7 +1306,13 @@ AAC_ENCODER_ERROR FDKaacEnc_updateFillBits(CHANNEL_MAPPING*          cm,
       INT bitResSpace = qcKernel->bitResTotMax - qcKernel->bitResTot ;
       /* processing fill-bits */
       INT deltaBitRes = qcOut[0]->grantedDynBits - qcOut[0]->usedDynBits ;
-      qcOut[0]->totFillBits = fixMax((deltaBitRes&7), (deltaBitRes - (fixMax(0,bitResSpace-7)&~7)));
+      if (qcKernel->bitResDrain) {
+        /* leave less than one byte in the bit reservoir, alignment bits may take up to 7 bits more */
+        qcOut[0]->totFillBits = fixMax(0, (deltaBitRes + qcKernel->bitResTot - 7)&~7);
+      }
+      else {
+        qcOut[0]->totFillBits = fixMax((deltaBitRes&7), (deltaBitRes - (fixMax(0,bitResSpace-7)&~7)));
+      }
       qcOut[0]->totalBits = qcOut[0]->staticBits + qcOut[0]->usedDynBits + qcOut[0]->totFillBits + qcOut[0]->elementExtBits + qcOut[0]->globalExtBits;
       qcOut[0]->totFillBits += ( fixMax(0, qcKernel->minBitsPerFrame - qcOut[0]->totalBits) + 7) & ~7;
       break;
@@ -1387,7 +1427,7 @@ AAC_ENCODER_ERROR FDKaacEnc_FinalizeBitConsumption(CHANNEL_MAPPING *cm,
       INT diffFillBits = 0;
 
       /* How many bits can be taken by bitreservoir */
-      const INT bitresSpace = qcKernel->bitResTotMax - (qcKernel->bitResTot + (qcOut->grantedDynBits - (qcOut->usedDynBits + qcOut->totFillBits) ) );
+      const INT bitresSpace = ((qcKernel->bitResDrain) ? 0 : qcKernel->bitResTotMax) - (qcKernel->bitResTot + (qcOut->grantedDynBits - (qcOut->usedDynBits + qcOut->totFillBits) ) );
 
       /* Number of bits which can be moved to bitreservoir. */
       const INT bitsToBitres = qcKernel->globHdrBits - exactTpBits;
@@ -158,6 +158,11 @@ AAC_ENCODER_ERROR FDKaacEnc_FinalizeBitConsumption( CHANNEL_MAPPING *cm,
                                                     SCHAR               epConfig
                                                   );
 
+/* distribute the total bitreservoir to the elements, done by FDKaacEnc_QCMain() for each frame */
+AAC_ENCODER_ERROR FDKaacEnc_BitResRedistribution(QC_STATE *const              hQC,
+                                                 const CHANNEL_MAPPING *const cm,
+                                                 const INT                    avgTotalBits);
+
 AAC_ENCODER_ERROR FDKaacEnc_AdjustBitrate(QC_STATE *RESTRICT hQC,
                   CHANNEL_MAPPING *RESTRICT cm,
                   INT *avgTotalBits,
@@ -89,9 +89,45 @@ amm-info@iis.fraunhofer.de
 ******************************************************************************/
 
 #include "quantize.h"
+#include "dyn_bits.h"
 
 #include "aacEnc_rom.h"
 
+/*****************************************************************************
+
+    functionname: FDKaacEnc_quantizeLine
+    description: quantizes one spectrum line without data dependent branches,
+                 the sign is applied and zero lines are masked arithmetically
+    returns: quantized line
+    input: spectral line, quantizer of global gain, dead zone rounding offset
+    output:
+
+*****************************************************************************/
+static inline SHORT FDKaacEnc_quantizeLine(FIXP_DBL spec,
+                                           FIXP_QTD quantizer,
+                                           INT      quantizershift,
+                                           FIXP_DBL k)
+{
+  FIXP_DBL accu = fMultDiv2(spec,quantizer);
+  INT      sign    = (INT)(accu >> (DFRACT_BITS-1));         /* 0 or -1 */
+  INT      nonZero = -(INT)(accu != FL2FXCONST_DBL(0.0f));   /* 0 or -1 */
+
+  accu = (accu ^ sign) - sign;
+
+  /* normalize, bit 0 does not change the count of a non-zero value and keeps clz() defined for zero */
+  INT   accuShift = CntLeadingZeros(accu | (FIXP_DBL)1) - 1;
+  accu <<= accuShift;
+  INT tabIndex = (INT)(accu>>(DFRACT_BITS-2-MANT_DIGITS))&(~MANT_SIZE);
+  INT totalShift = quantizershift-accuShift+1;
+  accu = fMultDiv2(FDKaacEnc_mTab_3_4[tabIndex],FDKaacEnc_quantTableE[totalShift&3]);
+  totalShift = (16-4)-(3*(totalShift>>2));
+  FDK_ASSERT(totalShift >=0); /* MAX_QUANT_VIOLATION */
+  accu >>= fixMin(totalShift,DFRACT_BITS-1);
+  accu = (LONG)(k + (accu & nonZero)) >> (DFRACT_BITS-1-16);
+
+  return (SHORT)((accu ^ sign) - sign);
+}
+
 /*****************************************************************************
 
     functionname: FDKaacEnc_quantizeLines
@@ -101,6 +137,16 @@ amm-info@iis.fraunhofer.de
     output: quantized spectrum
 
 *****************************************************************************/
+static inline FIXP_DBL FDKaacEnc_quantRoundingOffset(INT dZoneQuantEnable)
+{
+  const INT kShift=16;
+
+  if (dZoneQuantEnable)
+    return FL2FXCONST_DBL(0.23f)>>kShift;
+  else
+    return FL2FXCONST_DBL(-0.0946f + 0.5f)>>kShift;
+}
+
 static void FDKaacEnc_quantizeLines(INT      gain,
                           INT      noOfLines,
                           FIXP_DBL *mdctSpectrum,
@@ -108,158 +154,97 @@ static void FDKaacEnc_quantizeLines(INT      gain,
                           INT      dZoneQuantEnable)
 {
   int   line;
-  FIXP_DBL k = FL2FXCONST_DBL(0.0f);
+  FIXP_DBL k = FDKaacEnc_quantRoundingOffset(dZoneQuantEnable);
   FIXP_QTD quantizer = FDKaacEnc_quantTableQ[(-gain)&3];
   INT      quantizershift = ((-gain)>>2)+1;
-  const INT kShift=16;
-
-  if (dZoneQuantEnable)
-    k = FL2FXCONST_DBL(0.23f)>>kShift;
-  else
-    k = FL2FXCONST_DBL(-0.0946f + 0.5f)>>kShift;
 
+  /* k < 0.5 LSB of the result, so lines quantized to zero stay zero */
   for (line = 0; line < noOfLines; line++)
   {
-    FIXP_DBL accu = fMultDiv2(mdctSpectrum[line],quantizer);
-
-    if (accu < FL2FXCONST_DBL(0.0f))
-    {
-      accu=-accu;
-      /* normalize */
-      INT   accuShift = CntLeadingZeros(accu) - 1;  /* CountLeadingBits() is not necessary here since test value is always > 0 */
-      accu <<= accuShift;
-      INT tabIndex = (INT)(accu>>(DFRACT_BITS-2-MANT_DIGITS))&(~MANT_SIZE);
-      INT totalShift = quantizershift-accuShift+1;
-      accu = fMultDiv2(FDKaacEnc_mTab_3_4[tabIndex],FDKaacEnc_quantTableE[totalShift&3]);
-      totalShift = (16-4)-(3*(totalShift>>2));
-      FDK_ASSERT(totalShift >=0); /* MAX_QUANT_VIOLATION */
-      accu >>= fixMin(totalShift,DFRACT_BITS-1);
-      quaSpectrum[line] = (SHORT)(-((LONG)(k + accu) >> (DFRACT_BITS-1-16)));
-    }
-    else if(accu > FL2FXCONST_DBL(0.0f))
-    {
-      /* normalize */
-      INT   accuShift = CntLeadingZeros(accu) - 1;  /* CountLeadingBits() is not necessary here since test value is always > 0 */
-      accu <<= accuShift;
-      INT tabIndex = (INT)(accu>>(DFRACT_BITS-2-MANT_DIGITS))&(~MANT_SIZE);
-      INT totalShift = quantizershift-accuShift+1;
-      accu = fMultDiv2(FDKaacEnc_mTab_3_4[tabIndex],FDKaacEnc_quantTableE[totalShift&3]);
-      totalShift = (16-4)-(3*(totalShift>>2));
-      FDK_ASSERT(totalShift >=0); /* MAX_QUANT_VIOLATION */
-      accu >>= fixMin(totalShift,DFRACT_BITS-1);
-      quaSpectrum[line] = (SHORT)((LONG)(k + accu) >> (DFRACT_BITS-1-16));
-    }
-    else
-      quaSpectrum[line]=0;
+    quaSpectrum[line] = FDKaacEnc_quantizeLine(mdctSpectrum[line], quantizer, quantizershift, k);
   }
 }
 
 
 /*****************************************************************************
 
-    functionname:iFDKaacEnc_quantizeLines
-    description: iquantizes spectrum lines
+    functionname: FDKaacEnc_invQuantizeLine
+    description: iquantizes one spectrum line without data dependent branches
                  mdctSpectrum = iquaSpectrum^4/3 *2^(0.25*gain)
-    input: global gain, number of lines to process,quantized spectrum
-    output: spectral data
+    returns: spectral line
+    input: gain&3, gain>>2, quantized line
 
 *****************************************************************************/
-static void FDKaacEnc_invQuantizeLines(INT  gain,
-                             INT  noOfLines,
-                             SHORT *quantSpectrum,
-                             FIXP_DBL *mdctSpectrum)
-
+static inline FIXP_DBL FDKaacEnc_invQuantizeLine(INT   iquantizermod,
+                                                 INT   iquantizershift,
+                                                 SHORT quantSpectrum)
 {
-  INT iquantizermod;
-  INT iquantizershift;
-  INT line;
-
-  iquantizermod = gain&3;
-  iquantizershift = gain>>2;
-
-  for (line = 0; line < noOfLines; line++) {
-
-    if(quantSpectrum[line] < 0) {
-      FIXP_DBL accu;
-      INT ex,specExp,tabIndex;
-      FIXP_DBL s,t;
-
-      accu = (FIXP_DBL) -quantSpectrum[line];
-
-      ex = CountLeadingBits(accu);
-      accu <<= ex;
-      specExp = (DFRACT_BITS-1) - ex;
+  FIXP_DBL accu;
+  INT ex,specExp,tabIndex,shift;
+  FIXP_DBL s,t;
+  INT      sign    = (INT)quantSpectrum >> (DFRACT_BITS-1);  /* 0 or -1 */
+  INT      nonZero = -(INT)(quantSpectrum != 0);            /* 0 or -1 */
 
-      FDK_ASSERT(specExp < 14);       /* this fails if abs(value) > 8191 */
+  accu = (FIXP_DBL)(((INT)quantSpectrum ^ sign) - sign);
 
-      tabIndex = (INT)(accu>>(DFRACT_BITS-2-MANT_DIGITS))&(~MANT_SIZE);
+  ex = CountLeadingBits(accu | (FIXP_DBL)1);
+  accu <<= ex;
+  specExp = (DFRACT_BITS-1) - ex;
 
-      /* calculate "mantissa" ^4/3 */
-      s = FDKaacEnc_mTab_4_3Elc[tabIndex];
+  FDK_ASSERT(specExp < 14);       /* this fails if abs(value) > 8191 */
 
-      /* get approperiate exponent multiplier for specExp^3/4 combined with scfMod */
-      t = FDKaacEnc_specExpMantTableCombElc[iquantizermod][specExp];
+  tabIndex = (INT)(accu>>(DFRACT_BITS-2-MANT_DIGITS))&(~MANT_SIZE);
 
-      /* multiply "mantissa" ^4/3 with exponent multiplier */
-      accu = fMult(s,t);
+  /* calculate "mantissa" ^4/3 */
+  s = FDKaacEnc_mTab_4_3Elc[tabIndex];
 
-      /* get approperiate exponent shifter */
-      specExp = FDKaacEnc_specExpTableComb[iquantizermod][specExp]-1; /* -1 to avoid overflows in accu */
+  /* get approperiate exponent multiplier for specExp^3/4 combined with scfMod */
+  t = FDKaacEnc_specExpMantTableCombElc[iquantizermod][specExp];
 
-      if ((-iquantizershift-specExp) < 0)
-        accu <<= -(-iquantizershift-specExp);
-      else
-        accu >>= -iquantizershift-specExp;
+  /* multiply "mantissa" ^4/3 with exponent multiplier */
+  accu = fMult(s,t);
 
-      mdctSpectrum[line] = -accu;
-    }
-    else if (quantSpectrum[line] > 0) {
-      FIXP_DBL accu;
-      INT ex,specExp,tabIndex;
-      FIXP_DBL s,t;
-
-      accu = (FIXP_DBL)(INT)quantSpectrum[line];
-
-      ex = CountLeadingBits(accu);
-      accu <<= ex;
-      specExp = (DFRACT_BITS-1) - ex;
-
-      FDK_ASSERT(specExp < 14);       /* this fails if abs(value) > 8191 */
+  /* get approperiate exponent shifter */
+  specExp = FDKaacEnc_specExpTableComb[iquantizermod][specExp]-1; /* -1 to avoid overflows in accu */
 
-      tabIndex = (INT)(accu>>(DFRACT_BITS-2-MANT_DIGITS))&(~MANT_SIZE);
+  /* one of both shifts is zero */
+  shift = -iquantizershift-specExp;
+  accu = (accu << fixMax(-shift,0)) >> fixMax(shift,0);
 
-      /* calculate "mantissa" ^4/3 */
-      s = FDKaacEnc_mTab_4_3Elc[tabIndex];
+  accu &= nonZero;
 
-      /* get approperiate exponent multiplier for specExp^3/4 combined with scfMod */
-      t = FDKaacEnc_specExpMantTableCombElc[iquantizermod][specExp];
+  return (accu ^ sign) - sign;
+}
 
-      /* multiply "mantissa" ^4/3 with exponent multiplier */
-      accu = fMult(s,t);
+/*****************************************************************************
 
-      /* get approperiate exponent shifter */
-      specExp = FDKaacEnc_specExpTableComb[iquantizermod][specExp]-1; /* -1 to avoid overflows in accu */
+    functionname: FDKaacEnc_maxAbsQuant
+    description: get maximum absolute value of quantized spectrum lines
+    returns: maximum absolute value
+    input: quantized spectrum, number of lines
 
-      if (( -iquantizershift-specExp) < 0)
-        accu <<= -(-iquantizershift-specExp);
-      else
-        accu >>= -iquantizershift-specExp;
+*****************************************************************************/
+static inline INT FDKaacEnc_maxAbsQuant(const SHORT *quantSpectrum,
+                                        INT          noOfLines)
+{
+  INT i, maxVal = 0;
 
-      mdctSpectrum[line] = accu;
-    }
-    else {
-      mdctSpectrum[line] = FL2FXCONST_DBL(0.0f);
-    }
+  for (i=0; i<noOfLines; i++) {
+    maxVal = fixMax(maxVal, fAbs((INT)quantSpectrum[i]));
   }
+
+  return maxVal;
 }
 
 /*****************************************************************************
 
     functionname: FDKaacEnc_QuantizeSpectrum
     description: quantizes the entire spectrum
+                 if sfbQuantGain is given, bands are skipped whose gain did not
+                 change or which are zero and are quantized with a larger gain now
     returns:
     input: number of scalefactor bands to be quantized, ...
-    output: quantized spectrum
+    output: quantized spectrum, gain per quantized band
 
 *****************************************************************************/
 void FDKaacEnc_QuantizeSpectrum(INT sfbCnt,
@@ -270,7 +255,9 @@ void FDKaacEnc_QuantizeSpectrum(INT sfbCnt,
                       INT globalGain,
                       INT *scalefactors,
                       SHORT *quantizedSpectrum,
-                      INT dZoneQuantEnable)
+                      INT dZoneQuantEnable,
+                      const UINT *maxValueInSfb,
+                      INT *sfbQuantGain)
 {
   INT sfbOffs,sfb;
 
@@ -283,8 +270,19 @@ void FDKaacEnc_QuantizeSpectrum(INT sfbCnt,
   for (sfb = 0; sfb < maxSfbPerGroup; sfb++)
   {
     INT scalefactor = scalefactors[sfbOffs+sfb] ;
+    INT gain = globalGain - scalefactor;
+
+    if (sfbQuantGain != NULL) {
+      INT lastGain = sfbQuantGain[sfbOffs+sfb];
 
-    FDKaacEnc_quantizeLines(globalGain - scalefactor, /* QSS */
+      /* a coarser quantizer never turns a zero line into a non-zero one */
+      if ( (gain == lastGain) || ((lastGain != SFB_RATE_CACHE_INVALID) && (gain > lastGain) && (maxValueInSfb[sfbOffs+sfb] == 0)) )
+        continue;
+
+      sfbQuantGain[sfbOffs+sfb] = gain;
+    }
+
+    FDKaacEnc_quantizeLines(gain, /* QSS */
                   sfbOffset[sfbOffs+sfb+1] - sfbOffset[sfbOffs+sfb],
                   mdctSpectrum + sfbOffset[sfbOffs+sfb],
                   quantizedSpectrum + sfbOffset[sfbOffs+sfb],
@@ -312,22 +310,25 @@ FIXP_DBL FDKaacEnc_calcSfbDist(FIXP_DBL *mdctSpectrum,
   FIXP_DBL xfsf;
   FIXP_DBL diff;
   FIXP_DBL invQuantSpec;
+  FIXP_DBL k = FDKaacEnc_quantRoundingOffset(dZoneQuantEnable);
+  FIXP_QTD quantizer = FDKaacEnc_quantTableQ[(-gain)&3];
+  INT      quantizershift = ((-gain)>>2)+1;
 
   xfsf = FL2FXCONST_DBL(0.0f);
 
+  /* quantization, the band is discarded at the first line violating MAX_QUANT,
+     the lines behind it are not quantized */
   for (i=0; i<noOfLines; i++) {
-    /* quantization */
-    FDKaacEnc_quantizeLines(gain,
-                  1,
-                 &mdctSpectrum[i],
-                 &quantSpectrum[i],
-                  dZoneQuantEnable);
+    quantSpectrum[i] = FDKaacEnc_quantizeLine(mdctSpectrum[i], quantizer, quantizershift, k);
 
-    if (fAbs(quantSpectrum[i])>MAX_QUANT) {
+    if (fAbs((INT)quantSpectrum[i])>MAX_QUANT) {
       return FL2FXCONST_DBL(0.0f);
     }
+  }
+
+  for (i=0; i<noOfLines; i++) {
     /* inverse quantization */
-    FDKaacEnc_invQuantizeLines(gain,1,&quantSpectrum[i],&invQuantSpec);
+    invQuantSpec = FDKaacEnc_invQuantizeLine(gain&3, gain>>2, quantSpectrum[i]);
 
     /* dist */
     diff = fixp_abs(fixp_abs(invQuantSpec) - fixp_abs(mdctSpectrum[i]>>1));
@@ -371,16 +372,16 @@ void FDKaacEnc_calcSfbQuantEnergyAndDist(FIXP_DBL *mdctSpectrum,
   FIXP_DBL energy = FL2FXCONST_DBL(0.0f);
   FIXP_DBL distortion = FL2FXCONST_DBL(0.0f);
 
-  for (i=0; i<noOfLines; i++) {
+  if (FDKaacEnc_maxAbsQuant(quantSpectrum, noOfLines)>MAX_QUANT) {
+    *en   = FL2FXCONST_DBL(0.0f);
+    *dist = FL2FXCONST_DBL(0.0f);
+    return;
+  }
 
-    if (fAbs(quantSpectrum[i])>MAX_QUANT) {
-      *en   = FL2FXCONST_DBL(0.0f);
-      *dist = FL2FXCONST_DBL(0.0f);
-      return;
-    }
+  for (i=0; i<noOfLines; i++) {
 
     /* inverse quantization */
-    FDKaacEnc_invQuantizeLines(gain,1,&quantSpectrum[i],&invQuantSpec);
+    invQuantSpec = FDKaacEnc_invQuantizeLine(gain&3, gain>>2, quantSpectrum[i]);
 
     /* energy */
     energy += fPow2(invQuantSpec);
@@ -103,7 +103,9 @@ void FDKaacEnc_QuantizeSpectrum(INT sfbCnt,
                       INT *sfbOffset, FIXP_DBL *mdctSpectrum,
                       INT globalGain, INT *scalefactors,
                       SHORT *quantizedSpectrum,
-                      INT dZoneQuantEnable);
+                      INT dZoneQuantEnable,
+                      const UINT *maxValueInSfb,
+                      INT *sfbQuantGain);
 
 FIXP_DBL FDKaacEnc_calcSfbDist(FIXP_DBL *mdctSpectrum,
                      SHORT *quantSpectrum,
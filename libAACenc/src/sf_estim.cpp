@@ -1208,7 +1208,7 @@ FDKaacEnc_FDKaacEnc_EstimateScaleFactorsChannel(QC_OUT_CHANNEL   *qcOutChannel,
                         minSfMaxQuant, sfbDistLdData, sfbConstPePart,
                         sfbFormFactorLdData, sfbNRelevantLines, minScfCalculated, 1);
 
-    if(invQuant > 1) {
+    if(invQuant > 2) {
       FDKaacEnc_assimilateMultipleScf(psyOutChannel, qcOutChannel, quantSpec, quantSpecTmp,
                         dZoneQuantEnable,
                         scf,
@@ -157,6 +157,12 @@ amm-info@iis.fraunhofer.de
 #include "armintr.h"
 #endif
 
+/* Select fft(), dct_IV() and QMF prototype filter kernels at runtime (see FDK_cpu.h).
+   Not needed if the whole library is already built for AVX2 or wider. */
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(__AVX2__) && !defined(FDK_DISABLE_CPU_DISPATCH)
+#define FDK_CPU_DISPATCH
+#endif
+
 
 /* Define preferred Multiplication type */
 #if defined(FDK_HIGH_PERFORMANCE) && !defined(FDK_HIGH_QUALITY) /* FDK_HIGH_PERFORMANCE */
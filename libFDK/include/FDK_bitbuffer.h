@@ -134,8 +134,12 @@ INT  FDK_get             (HANDLE_FDK_BITBUF hBitBuffer, const UINT numberOfBits)
 
 INT  FDK_get32           (HANDLE_FDK_BITBUF hBitBuffer) ;
 
+UINT64 FDK_get64         (HANDLE_FDK_BITBUF hBitBuffer, const UINT numberOfBits) ;
+
 void FDK_put             (HANDLE_FDK_BITBUF hBitBuffer, UINT value, const UINT numberOfBits) ;
 
+void FDK_put64           (HANDLE_FDK_BITBUF hBitBuffer, UINT64 value, const UINT numberOfBits) ;
+
 INT  FDK_getBwd          (HANDLE_FDK_BITBUF hBitBuffer, const UINT numberOfBits);
 void FDK_putBwd          (HANDLE_FDK_BITBUF hBitBuffer, UINT value, const UINT numberOfBits) ;
 
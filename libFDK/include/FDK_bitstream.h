@@ -98,7 +98,9 @@ amm-info@iis.fraunhofer.de
 
 #include "genericStds.h"
 
-#define CACHE_BITS 32
+#define CACHE_BITS      32     /*!< Cache size of the backward reader and writer. */
+#define CACHE_WORD_BITS 64     /*!< Cache word size of the forward reader and writer. */
+#define CACHE_FILL_READ 56     /*!< Maximum number of bits held by the forward reader after a refill. */
 
 typedef enum {
     BS_READER,
@@ -108,7 +110,7 @@ typedef enum {
 
 typedef struct
 {
-  UINT       CacheWord ;
+  UINT64     CacheWord ;
   UINT       BitsInCache ;
   FDK_BITBUF hBitBuf;
   UINT       ConfigCache ;
@@ -246,22 +248,23 @@ FDK_INLINE UINT FDKreadBits(HANDLE_FDK_BITSTREAM hBitStream,
   if (hBitStream->BitsInCache <= numberOfBits)
   {
     const INT  validBits  = FDK_getValidBits (&hBitStream->hBitBuf) ;
-    const INT  freeBits   = (CACHE_BITS-1) - hBitStream->BitsInCache ;
-    const INT  bitsToRead = (freeBits <= validBits) ? freeBits : validBits ;
+    const INT  freeBits   = CACHE_FILL_READ - hBitStream->BitsInCache ;
+    /* validBits turns negative when a corrupted stream was read beyond its end */
+    const INT  bitsToRead = (validBits <= 0) ? 0 : ((freeBits <= validBits) ? freeBits : validBits) ;
 
-    hBitStream->CacheWord = (hBitStream->CacheWord << bitsToRead) | FDK_get (&hBitStream->hBitBuf,bitsToRead) ;
+    hBitStream->CacheWord = (hBitStream->CacheWord << bitsToRead) | FDK_get64 (&hBitStream->hBitBuf,bitsToRead) ;
     hBitStream->BitsInCache += bitsToRead ;
     if (hBitStream->BitsInCache < numberOfBits)
     {
       hBitStream->CacheWord <<= numberOfBits - hBitStream->BitsInCache;
       hBitStream->BitsInCache = 0;
-      return (hBitStream->CacheWord >> hBitStream->BitsInCache) & validMask ;
+      return (UINT)hBitStream->CacheWord & validMask ;
     }
   }
 
   hBitStream->BitsInCache -= numberOfBits ;
 
-  return (hBitStream->CacheWord >> hBitStream->BitsInCache) & validMask ;
+  return (UINT)(hBitStream->CacheWord >> hBitStream->BitsInCache) & validMask ;
 #endif
 }
 
@@ -272,14 +275,14 @@ FDK_INLINE UINT FDKreadBit(HANDLE_FDK_BITSTREAM hBitStream)
   {
     const UINT validBits = FDK_getValidBits (&hBitStream->hBitBuf);
 
-    if (validBits >= 32)
+    if (validBits >= CACHE_FILL_READ)
     {
-      hBitStream->CacheWord = FDK_get32 (&hBitStream->hBitBuf);
-      hBitStream->BitsInCache = CACHE_BITS;
+      hBitStream->CacheWord = FDK_get64 (&hBitStream->hBitBuf,CACHE_FILL_READ);
+      hBitStream->BitsInCache = CACHE_FILL_READ;
     }
     else if (validBits > 0)
     {
-      hBitStream->CacheWord = FDK_get (&hBitStream->hBitBuf,validBits);
+      hBitStream->CacheWord = FDK_get64 (&hBitStream->hBitBuf,validBits);
       hBitStream->BitsInCache = validBits;
     }
     else
@@ -289,7 +292,7 @@ FDK_INLINE UINT FDKreadBit(HANDLE_FDK_BITSTREAM hBitStream)
   }
   hBitStream->BitsInCache--;
 
-  return (hBitStream->CacheWord >> hBitStream->BitsInCache) & 1;
+  return (UINT)(hBitStream->CacheWord >> hBitStream->BitsInCache) & 1;
 #else
  return FDKreadBits(hBitStream,1);
 #endif
@@ -310,14 +313,14 @@ inline UINT FDKread2Bits(HANDLE_FDK_BITSTREAM hBitStream)
   if (BitsInCache < 2)  /* Comparison changed from 'less-equal' to 'less' */
   {
     const INT  validBits  = FDK_getValidBits (&hBitStream->hBitBuf) ;
-    const INT  freeBits   = (CACHE_BITS-1) - BitsInCache ;
-    const INT  bitsToRead = (freeBits <= validBits) ? freeBits : validBits ;
+    const INT  freeBits   = CACHE_FILL_READ - BitsInCache ;
+    const INT  bitsToRead = (validBits <= 0) ? 0 : ((freeBits <= validBits) ? freeBits : validBits) ;
 
-    hBitStream->CacheWord = (hBitStream->CacheWord << bitsToRead) | FDK_get (&hBitStream->hBitBuf,bitsToRead) ;
+    hBitStream->CacheWord = (hBitStream->CacheWord << bitsToRead) | FDK_get64 (&hBitStream->hBitBuf,bitsToRead) ;
     BitsInCache += bitsToRead;
   }
   hBitStream->BitsInCache = BitsInCache - 2;
-  return (hBitStream->CacheWord >> hBitStream->BitsInCache) & 0x3;
+  return (UINT)(hBitStream->CacheWord >> hBitStream->BitsInCache) & 0x3;
 }
 
 /**
@@ -343,7 +346,7 @@ FDK_INLINE UINT FDKreadBitsBwd(HANDLE_FDK_BITSTREAM hBitStream,
 
   hBitStream->BitsInCache -= numberOfBits ;
 
-  return (hBitStream->CacheWord >> hBitStream->BitsInCache) & validMask ;
+  return (UINT)(hBitStream->CacheWord >> hBitStream->BitsInCache) & validMask ;
 }
 
 
@@ -375,16 +378,21 @@ FDK_INLINE UCHAR FDKwriteBits(HANDLE_FDK_BITSTREAM hBitStream, UINT value,
 {
   const UINT validMask = BitMask [numberOfBits] ;
 
-  if ((hBitStream->BitsInCache+numberOfBits) < CACHE_BITS)
+  if ((hBitStream->BitsInCache+numberOfBits) < CACHE_WORD_BITS)
   {
     hBitStream->BitsInCache += numberOfBits ;
     hBitStream->CacheWord   =  (hBitStream->CacheWord << numberOfBits) | (value & validMask);
   }
   else
   {
-    FDK_put(&hBitStream->hBitBuf, hBitStream->CacheWord, hBitStream->BitsInCache) ;
-    hBitStream->BitsInCache = numberOfBits ;
-    hBitStream->CacheWord   = (value & validMask) ;
+    /* complete the cache word, flush it as a whole and keep the remaining bits */
+    const UINT freeBits = CACHE_WORD_BITS - hBitStream->BitsInCache ;
+    const UINT restBits = numberOfBits - freeBits ;
+
+    value &= validMask ;
+    FDK_put64(&hBitStream->hBitBuf, (hBitStream->CacheWord << freeBits) | (value >> restBits), CACHE_WORD_BITS) ;
+    hBitStream->BitsInCache = restBits ;
+    hBitStream->CacheWord   = value ;
   }
 
  return numberOfBits;
@@ -411,7 +419,7 @@ FDK_INLINE UCHAR FDKwriteBitsBwd(HANDLE_FDK_BITSTREAM hBitStream, UINT value,
   }
   else
   {
-    FDK_putBwd(&hBitStream->hBitBuf, hBitStream->CacheWord, hBitStream->BitsInCache) ;
+    FDK_putBwd(&hBitStream->hBitBuf, (UINT)hBitStream->CacheWord, hBitStream->BitsInCache) ;
     hBitStream->BitsInCache = numberOfBits ;
     hBitStream->CacheWord   = (value & validMask) ;
   }
@@ -431,7 +439,7 @@ FDK_INLINE void FDKsyncCache (HANDLE_FDK_BITSTREAM hBitStream)
   if (hBitStream->ConfigCache == BS_READER)
     FDK_pushBack (&hBitStream->hBitBuf,hBitStream->BitsInCache,hBitStream->ConfigCache) ;
   else                        /* BS_WRITER */
-    FDK_put(&hBitStream->hBitBuf, hBitStream->CacheWord, hBitStream->BitsInCache) ;
+    FDK_put64(&hBitStream->hBitBuf, hBitStream->CacheWord, hBitStream->BitsInCache) ;
 
   hBitStream->BitsInCache = 0 ;
   hBitStream->CacheWord   = 0 ;
@@ -449,7 +457,7 @@ FDK_INLINE void FDKsyncCacheBwd (HANDLE_FDK_BITSTREAM hBitStream)
   if (hBitStream->ConfigCache == BS_READER) {
     FDK_pushForward (&hBitStream->hBitBuf,hBitStream->BitsInCache,hBitStream->ConfigCache) ;
   } else {                      /* BS_WRITER */
-    FDK_putBwd (&hBitStream->hBitBuf, hBitStream->CacheWord, hBitStream->BitsInCache) ;
+    FDK_putBwd (&hBitStream->hBitBuf, (UINT)hBitStream->CacheWord, hBitStream->BitsInCache) ;
   }
 
   hBitStream->BitsInCache = 0 ;
@@ -517,7 +525,7 @@ FDK_INLINE void FDKbyteAlign (HANDLE_FDK_BITSTREAM hBitStream, UINT alignmentAnc
  */
 FDK_INLINE void FDKpushBackCache (HANDLE_FDK_BITSTREAM hBitStream, const UINT numberOfBits)
 {
-  FDK_ASSERT ((hBitStream->BitsInCache+numberOfBits)<=CACHE_BITS);
+  FDK_ASSERT ((hBitStream->BitsInCache+numberOfBits)<=CACHE_WORD_BITS);
   hBitStream->BitsInCache += numberOfBits ;
 }
 
@@ -0,0 +1,159 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2013 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+/***************************  Fraunhofer IIS FDK Tools  ***********************
+
+   Author(s):
+   Description: CPU feature detection and runtime kernel dispatch
+
+******************************************************************************/
+
+#ifndef FDK_CPU_H
+#define FDK_CPU_H
+
+#include "common_fix.h"
+#include "qmf.h"
+
+/**
+ * CPU feature flags as returned by FDK_getCpuFeatures(). A flag is only set if
+ * both the processor and the operating system support the instruction set.
+ */
+#define FDK_CPU_SSE2    0x0001
+#define FDK_CPU_SSE4_1  0x0002
+#define FDK_CPU_AVX2    0x0004
+#define FDK_CPU_AVX512  0x0008  /*!< AVX-512 F, BW and VL */
+
+/**
+ * \brief Query the instruction set extensions of the host processor.
+ *        The CPUID probe is done once during static initialization.
+ * \return Combination of FDK_CPU_* flags, 0 if unknown or not an x86 host.
+ */
+UINT FDK_getCpuFeatures(void);
+
+#if defined(FDK_CPU_DISPATCH)
+
+/* Each kernel variant is the generic C code compiled for a wider instruction
+   set: the wrapper carries the target attribute and flatten pulls the generic
+   implementation (and all its helpers in the same file) into it. AVX-512 hosts
+   use the AVX2 variants; 512 bit clones of these short loops were not faster. */
+#define FDK_CPU_TARGET_AVX2   __attribute__((target("avx2"), flatten))
+
+typedef struct
+{
+  void (*fft)(int length, FIXP_DBL *pInput, INT *scalefactor);
+  void (*dit_fft)(FIXP_DBL *x, const INT ldn, const FIXP_STP *trigdata, const INT trigDataSize);
+  void (*dct_IV)(FIXP_DBL *pDat, int L, int *pDat_e);
+  void (*qmfAnaPrototypeFirSlot)(FIXP_QMF *analysisBuffer, int no_channels, const FIXP_PFT *p_filter,
+                                 int p_stride, FIXP_QAS *RESTRICT pFilterStates);
+  void (*qmfSynPrototypeFirSlot)(HANDLE_QMF_FILTER_BANK qmf, FIXP_QMF *RESTRICT realSlot,
+                                 FIXP_QMF *RESTRICT imagSlot, INT_PCM *RESTRICT timeOut, int stride);
+} FDK_CPU_KERNELS;
+
+/** Fastest available variant of each dispatched kernel (fft(), dit_fft(), dct_IV() and
+    the QMF prototype filter slots) according to FDK_getCpuFeatures(). Bound once during
+    static initialization and read-only afterwards. All variants are bit-exact, so the
+    binding only affects speed. */
+extern const FDK_CPU_KERNELS FDK_cpuKernels;
+
+void fft_generic(int length, FIXP_DBL *pInput, INT *scalefactor);
+void fft_avx2   (int length, FIXP_DBL *pInput, INT *scalefactor);
+
+void dit_fft_generic(FIXP_DBL *x, const INT ldn, const FIXP_STP *trigdata, const INT trigDataSize);
+void dit_fft_avx2   (FIXP_DBL *x, const INT ldn, const FIXP_STP *trigdata, const INT trigDataSize);
+
+void dct_IV_generic(FIXP_DBL *pDat, int L, int *pDat_e);
+void dct_IV_avx2   (FIXP_DBL *pDat, int L, int *pDat_e);
+
+void qmfAnaPrototypeFirSlot_generic(FIXP_QMF *analysisBuffer, int no_channels, const FIXP_PFT *p_filter,
+                                    int p_stride, FIXP_QAS *RESTRICT pFilterStates);
+void qmfAnaPrototypeFirSlot_avx2   (FIXP_QMF *analysisBuffer, int no_channels, const FIXP_PFT *p_filter,
+                                    int p_stride, FIXP_QAS *RESTRICT pFilterStates);
+
+void qmfSynPrototypeFirSlot_generic(HANDLE_QMF_FILTER_BANK qmf, FIXP_QMF *RESTRICT realSlot,
+                                    FIXP_QMF *RESTRICT imagSlot, INT_PCM *RESTRICT timeOut, int stride);
+void qmfSynPrototypeFirSlot_avx2   (HANDLE_QMF_FILTER_BANK qmf, FIXP_QMF *RESTRICT realSlot,
+                                    FIXP_QMF *RESTRICT imagSlot, INT_PCM *RESTRICT timeOut, int stride);
+
+#endif /* FDK_CPU_DISPATCH */
+
+#endif /* FDK_CPU_H */
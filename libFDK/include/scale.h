@@ -104,6 +104,9 @@ amm-info@iis.fraunhofer.de
 #elif defined(__mips__)	/* cppp replaced: elif */
 #include "mips/scale.h"
 
+#elif defined(__x86__)
+#include "x86/scale_x86.h"
+
 #endif
 
 
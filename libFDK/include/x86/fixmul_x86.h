@@ -130,6 +130,45 @@ inline INT fixmuldiv2_DD (INT a, const INT b)
   return a ;
 }
 
+/* ############################################################################# */
+#elif defined(__GNUC__) && defined(__x86_64__)
+/* x86-64: plain 64 bit products. Unlike the inline asm below these do not act as
+   scheduling barriers, so loops around fMult()/fMultDiv2() may be auto-vectorized
+   (pmuldq) when SSE4.1/AVX2 code generation is enabled. Results are bit-exact. */
+
+#define FUNCTION_fixmul_DD
+#define FUNCTION_fixmuldiv2_DD
+
+#define FUNCTION_fixmuldiv2BitExact_DD
+#define fixmuldiv2BitExact_DD(a,b) fixmuldiv2_DD(a,b)
+
+#define FUNCTION_fixmulBitExact_DD
+#define fixmulBitExact_DD(a,b) fixmul_DD(a,b)
+
+#define FUNCTION_fixmuldiv2_DS
+
+#define FUNCTION_fixmuldiv2BitExact_DS
+#define fixmuldiv2BitExact_DS(a,b) fixmuldiv2_DS(a,b)
+
+#define FUNCTION_fixmulBitExact_DS
+#define fixmulBitExact_DS(a,b) fixmul_DS(a,b)
+
+inline INT fixmuldiv2_DD (const INT a, const INT b)
+{
+  return (INT) ((((INT64)a) * b) >> 32);
+}
+
+inline INT fixmul_DD (const INT a, const INT b)
+{
+  return fixmuldiv2_DD(a, b) << 1;
+}
+
+/* (a * (b<<16)) >> 32 == (a * b) >> 16 */
+inline INT fixmuldiv2_DS (const INT a, const SHORT b)
+{
+  return (INT) ((((INT64)a) * b) >> 16);
+}
+
 /* ############################################################################# */
 #elif (defined(__GNUC__)||defined(__gnu_linux__)) && defined(__x86__)
 
@@ -211,6 +211,45 @@ INT FDK_get32 (HANDLE_FDK_BITBUF hBitBuf)
   }
 }
 
+UINT64 FDK_get64 (HANDLE_FDK_BITBUF hBitBuf, const UINT numberOfBits)
+{
+  /* the cache word holds at most 57 bits beyond the bit offset */
+  if (numberOfBits == 0 || numberOfBits > 57 || numberOfBits > hBitBuf->ValidBits) return 0;
+
+  UINT byteOffset = hBitBuf->BitNdx >> 3 ;
+  UINT bitOffset  = hBitBuf->BitNdx & 0x07 ;
+  UINT64 tx ;
+
+  if ( (byteOffset + 8 <= hBitBuf->bufSize) && (hBitBuf->ValidBits + bitOffset >= 64) )
+  {
+    /* linear region: one unaligned 8 byte word, all of it valid data */
+    const UCHAR *pBuf = &hBitBuf->Buffer [byteOffset] ;
+
+    tx = ((UINT64)pBuf[0] << 56) | ((UINT64)pBuf[1] << 48) |
+         ((UINT64)pBuf[2] << 40) | ((UINT64)pBuf[3] << 32) |
+         ((UINT64)pBuf[4] << 24) | ((UINT64)pBuf[5] << 16) |
+         ((UINT64)pBuf[6] <<  8) |  (UINT64)pBuf[7] ;
+  }
+  else
+  {
+    /* close to the wraparound or to the end of the valid data: only touch the bytes needed */
+    UINT byteMask = hBitBuf->bufSize - 1 ;
+    UINT nBytes   = (numberOfBits + bitOffset + 7) >> 3 ;
+    UINT i ;
+
+    tx = 0 ;
+    for (i = 0; i < nBytes; i++) {
+      tx |= (UINT64)hBitBuf->Buffer [(byteOffset+i) & byteMask] << (56 - (i<<3)) ;
+    }
+  }
+
+  hBitBuf->BitNdx     = (hBitBuf->BitNdx + numberOfBits) & (hBitBuf->bufBits - 1) ;
+  hBitBuf->BitCnt    +=  numberOfBits ;
+  hBitBuf->ValidBits -=  numberOfBits ;
+
+  return (tx << bitOffset) >> (64 - numberOfBits) ;
+}
+
 INT FDK_getBwd (HANDLE_FDK_BITBUF hBitBuf, const UINT numberOfBits)
 {
   UINT byteOffset = hBitBuf->BitNdx >> 3 ;
@@ -273,6 +312,62 @@ void FDK_put (HANDLE_FDK_BITBUF hBitBuf, UINT value, const UINT numberOfBits)
   }
 }
 
+void FDK_put64 (HANDLE_FDK_BITBUF hBitBuf, UINT64 value, const UINT numberOfBits)
+{
+  FDK_ASSERT(numberOfBits <= 64);
+
+  if (numberOfBits == 0) return;
+
+  UINT byteOffset = hBitBuf->BitNdx >> 3 ;
+  UINT bitOffset  = hBitBuf->BitNdx & 0x07 ;
+
+  if (byteOffset + 9 <= hBitBuf->bufSize)
+  {
+    /* linear region: merge the left aligned word into 8 bytes (plus one overflow byte),
+       the bits around the written ones are preserved like in FDK_put() */
+    UCHAR *pBuf = &hBitBuf->Buffer [byteOffset] ;
+    UINT64 tx   = value << (64 - numberOfBits) ;
+    UINT64 mask = ((~(UINT64)0) << (64 - numberOfBits)) >> bitOffset ;
+    UINT64 word = ((UINT64)pBuf[0] << 56) | ((UINT64)pBuf[1] << 48) |
+                  ((UINT64)pBuf[2] << 40) | ((UINT64)pBuf[3] << 32) |
+                  ((UINT64)pBuf[4] << 24) | ((UINT64)pBuf[5] << 16) |
+                  ((UINT64)pBuf[6] <<  8) |  (UINT64)pBuf[7] ;
+
+    word = (word & ~mask) | (tx >> bitOffset) ;
+
+    pBuf[0] = (UCHAR)(word >> 56) ;
+    pBuf[1] = (UCHAR)(word >> 48) ;
+    pBuf[2] = (UCHAR)(word >> 40) ;
+    pBuf[3] = (UCHAR)(word >> 32) ;
+    pBuf[4] = (UCHAR)(word >> 24) ;
+    pBuf[5] = (UCHAR)(word >> 16) ;
+    pBuf[6] = (UCHAR)(word >>  8) ;
+    pBuf[7] = (UCHAR)(word) ;
+
+    if (bitOffset + numberOfBits > 64)
+    {
+      UINT overBits = bitOffset + numberOfBits - 64 ;
+
+      pBuf[8] = (UCHAR)(tx << (8 - bitOffset)) | (pBuf[8] & (0xFF >> overBits)) ;
+    }
+
+    hBitBuf->BitNdx     = (hBitBuf->BitNdx + numberOfBits) & (hBitBuf->bufBits - 1) ;
+    hBitBuf->BitCnt    +=  numberOfBits ;
+    hBitBuf->ValidBits +=  numberOfBits ;
+  }
+  else
+  {
+    /* close to the wraparound: two ring buffer writes */
+    if (numberOfBits > 32) {
+      FDK_put (hBitBuf, (UINT)(value >> 32), numberOfBits - 32) ;
+      FDK_put (hBitBuf, (UINT)value, 32) ;
+    }
+    else {
+      FDK_put (hBitBuf, (UINT)value, numberOfBits) ;
+    }
+  }
+}
+
 void FDK_putBwd (HANDLE_FDK_BITBUF hBitBuf, UINT value, const UINT numberOfBits)
 {
   UINT byteOffset = hBitBuf->BitNdx >> 3 ;
@@ -102,6 +102,7 @@ amm-info@iis.fraunhofer.de
 
 #include "FDK_tools_rom.h"
 #include "fft.h"
+#include "FDK_cpu.h"
 
 
 #if defined(__arm__)
@@ -301,7 +302,11 @@ void getTables(const FIXP_WTP **twiddle, const FIXP_STP **sin_twiddle, int *sin_
 
 #if !defined(FUNCTION_dct_IV)
 
+#if defined(FDK_CPU_DISPATCH)
+void dct_IV_generic(FIXP_DBL *pDat,
+#else
 void dct_IV(FIXP_DBL *pDat,
+#endif
             int L,
             int *pDat_e)
 {
@@ -408,6 +413,19 @@ void dct_IV(FIXP_DBL *pDat,
   /* Add twiddeling scale. */
   *pDat_e += 2;
 }
+
+#if defined(FDK_CPU_DISPATCH)
+FDK_CPU_TARGET_AVX2
+void dct_IV_avx2(FIXP_DBL *pDat, int L, int *pDat_e)
+{
+  dct_IV_generic(pDat, L, pDat_e);
+}
+
+void dct_IV(FIXP_DBL *pDat, int L, int *pDat_e)
+{
+  FDK_cpuKernels.dct_IV(pDat, L, pDat_e);
+}
+#endif /* FDK_CPU_DISPATCH */
 #endif /* defined (FUNCTION_dct_IV) */
 
 #if !defined(FUNCTION_dst_IV)
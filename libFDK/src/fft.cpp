@@ -92,6 +92,7 @@ amm-info@iis.fraunhofer.de
 
 #include "fft_rad2.h"
 #include "FDK_tools_rom.h"
+#include "FDK_cpu.h"
 
 
 
@@ -1329,7 +1330,11 @@ static inline void fft480(FIXP_DBL *pInput, INT *pScalefactor)
   *pScalefactor += SCALEFACTOR480;
 }
 
+#if defined(FDK_CPU_DISPATCH)
+void fft_generic(int length, FIXP_DBL *pInput, INT *pScalefactor)
+#else
 void fft(int length, FIXP_DBL *pInput, INT *pScalefactor)
+#endif
 {
   if (length == 32)
   {
@@ -1390,6 +1395,19 @@ void fft(int length, FIXP_DBL *pInput, INT *pScalefactor)
   }
 }
 
+#if defined(FDK_CPU_DISPATCH)
+FDK_CPU_TARGET_AVX2
+void fft_avx2(int length, FIXP_DBL *pInput, INT *pScalefactor)
+{
+  fft_generic(length, pInput, pScalefactor);
+}
+
+void fft(int length, FIXP_DBL *pInput, INT *pScalefactor)
+{
+  FDK_cpuKernels.fft(length, pInput, pScalefactor);
+}
+#endif /* FDK_CPU_DISPATCH */
+
 
 void ifft(int length, FIXP_DBL *pInput, INT *scalefactor)
 {
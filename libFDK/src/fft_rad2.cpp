@@ -91,6 +91,7 @@ amm-info@iis.fraunhofer.de
 #include "fft_rad2.h"
 
 #include "scramble.h"
+#include "FDK_cpu.h"
 
 #define __FFT_RAD2_CPP__
 
@@ -118,7 +119,11 @@ amm-info@iis.fraunhofer.de
 
 #ifndef FUNCTION_dit_fft
 
+#if defined(FDK_CPU_DISPATCH)
+void dit_fft_generic(FIXP_DBL *x, const INT ldn, const FIXP_STP *trigdata, const INT trigDataSize)
+#else
 void dit_fft(FIXP_DBL *x, const INT ldn, const FIXP_STP *trigdata, const INT trigDataSize)
+#endif
 {
     const INT n=1<<ldn;
     INT trigstep,i,ldm;
@@ -307,6 +312,19 @@ void dit_fft(FIXP_DBL *x, const INT ldn, const FIXP_STP *trigdata, const INT tri
         }
     }
 }
+
+#if defined(FDK_CPU_DISPATCH)
+FDK_CPU_TARGET_AVX2
+void dit_fft_avx2(FIXP_DBL *x, const INT ldn, const FIXP_STP *trigdata, const INT trigDataSize)
+{
+  dit_fft_generic(x, ldn, trigdata, trigDataSize);
+}
+
+void dit_fft(FIXP_DBL *x, const INT ldn, const FIXP_STP *trigdata, const INT trigDataSize)
+{
+  FDK_cpuKernels.dit_fft(x, ldn, trigdata, trigDataSize);
+}
+#endif /* FDK_CPU_DISPATCH */
 #endif
 
 
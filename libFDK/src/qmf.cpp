@@ -121,6 +121,7 @@ amm-info@iis.fraunhofer.de
 
 #include "fixpoint_math.h"
 #include "dct.h"
+#include "FDK_cpu.h"
 
 #ifdef QMFSYN_STATES_16BIT
 #define QSSCALE (7)
@@ -406,6 +407,40 @@ void qmfAnaPrototypeFirSlot_NonSymmetric(
 }
 #endif /* FUNCTION_qmfAnaPrototypeFirSlot_NonSymmetric */
 
+#if defined(FDK_CPU_DISPATCH)
+void qmfAnaPrototypeFirSlot_generic(FIXP_QMF *analysisBuffer, int no_channels, const FIXP_PFT *p_filter,
+                                    int p_stride, FIXP_QAS *RESTRICT pFilterStates)
+{
+  qmfAnaPrototypeFirSlot(analysisBuffer, no_channels, p_filter, p_stride, pFilterStates);
+}
+
+FDK_CPU_TARGET_AVX2
+void qmfAnaPrototypeFirSlot_avx2(FIXP_QMF *analysisBuffer, int no_channels, const FIXP_PFT *p_filter,
+                                 int p_stride, FIXP_QAS *RESTRICT pFilterStates)
+{
+  qmfAnaPrototypeFirSlot(analysisBuffer, no_channels, p_filter, p_stride, pFilterStates);
+}
+
+void qmfSynPrototypeFirSlot_generic(HANDLE_QMF_FILTER_BANK qmf, FIXP_QMF *RESTRICT realSlot,
+                                    FIXP_QMF *RESTRICT imagSlot, INT_PCM *RESTRICT timeOut, int stride)
+{
+  qmfSynPrototypeFirSlot(qmf, realSlot, imagSlot, timeOut, stride);
+}
+
+FDK_CPU_TARGET_AVX2
+void qmfSynPrototypeFirSlot_avx2(HANDLE_QMF_FILTER_BANK qmf, FIXP_QMF *RESTRICT realSlot,
+                                 FIXP_QMF *RESTRICT imagSlot, INT_PCM *RESTRICT timeOut, int stride)
+{
+  qmfSynPrototypeFirSlot(qmf, realSlot, imagSlot, timeOut, stride);
+}
+
+#define QMF_ANA_PROTOTYPE_FIR_SLOT FDK_cpuKernels.qmfAnaPrototypeFirSlot
+#define QMF_SYN_PROTOTYPE_FIR_SLOT FDK_cpuKernels.qmfSynPrototypeFirSlot
+#else
+#define QMF_ANA_PROTOTYPE_FIR_SLOT qmfAnaPrototypeFirSlot
+#define QMF_SYN_PROTOTYPE_FIR_SLOT qmfSynPrototypeFirSlot
+#endif /* FDK_CPU_DISPATCH */
+
 /*!
  *
  * \brief Perform real-valued forward modulation of the time domain
@@ -574,7 +609,7 @@ qmfAnalysisFilteringSlot( HANDLE_QMF_FILTER_BANK anaQmf,  /*!< Handle of Qmf Syn
                               (FIXP_QAS*)anaQmf->FilterStates
                             );
     } else {
-      qmfAnaPrototypeFirSlot( pWorkBuffer,
+      QMF_ANA_PROTOTYPE_FIR_SLOT( pWorkBuffer,
                               anaQmf->no_channels,
                               anaQmf->p_filter,
                               anaQmf->p_stride,
@@ -878,7 +913,7 @@ void qmfSynthesisFilteringSlot( HANDLE_QMF_FILTER_BANK  synQmf,
                                  stride
                                );
     } else {
-        qmfSynPrototypeFirSlot ( synQmf,
+        QMF_SYN_PROTOTYPE_FIR_SLOT ( synQmf,
                                  pWorkBuffer,
                                  pWorkBuffer+synQmf->no_channels,
                                  timeOut,
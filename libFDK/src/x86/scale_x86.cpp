@@ -0,0 +1,346 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2013 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+/***************************  Fraunhofer IIS FDK Tools  **********************
+
+   Author(s):
+   Description: Scaling operations for x86 (SSE2, SSE4.1, AVX2)
+
+******************************************************************************/
+
+/* prevent multiple inclusion with re-definitions */
+#ifndef __INCLUDE_SCALE_X86__
+#define __INCLUDE_SCALE_X86__
+
+#if defined(__SSE2__) || (defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))))
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+
+/* All kernels below perform exactly the same integer operations as the generic
+   C code in scale.cpp, only several lanes at once. Output is bit-exact. */
+
+#define FUNCTION_scaleValues_SGL
+SCALE_INLINE
+void scaleValues(FIXP_SGL *vector,  /*!< Vector */
+                 INT len,            /*!< Length */
+                 INT scalefactor     /*!< Scalefactor */
+                 )
+{
+  INT i;
+
+  /* Return if scalefactor is Zero */
+  if (scalefactor==0) return;
+
+  if(scalefactor > 0){
+    scalefactor = fixmin_I(scalefactor,(INT)(DFRACT_BITS-1));
+    __m128i shift = _mm_cvtsi32_si128(scalefactor);
+    for (i = len>>3; i--; vector+=8) {
+      __m128i v = _mm_loadu_si128((__m128i*)vector);
+      _mm_storeu_si128((__m128i*)vector, _mm_sll_epi16(v, shift));
+    }
+    for (i = len&7; i--; ) {
+      *(vector++) <<= scalefactor;
+    }
+  } else {
+    INT negScalefactor = fixmin_I(-scalefactor,(INT)DFRACT_BITS-1);
+    __m128i shift = _mm_cvtsi32_si128(negScalefactor);
+    for (i = len>>3; i--; vector+=8) {
+      __m128i v = _mm_loadu_si128((__m128i*)vector);
+      _mm_storeu_si128((__m128i*)vector, _mm_sra_epi16(v, shift));
+    }
+    for (i = len&7; i--; ) {
+      *(vector++) >>= negScalefactor;
+    }
+  }
+}
+
+#define FUNCTION_scaleValues_DBL
+SCALE_INLINE
+void scaleValues(FIXP_DBL *vector,    /*!< Vector */
+                 INT len,             /*!< Length */
+                 INT scalefactor      /*!< Scalefactor */
+                )
+{
+  INT i;
+
+  /* Return if scalefactor is Zero */
+  if (scalefactor==0) return;
+
+  if(scalefactor > 0){
+    scalefactor = fixmin_I(scalefactor,(INT)DFRACT_BITS-1);
+    __m128i shift = _mm_cvtsi32_si128(scalefactor);
+#if defined(__AVX2__)
+    for (i = len>>3; i--; vector+=8) {
+      __m256i v = _mm256_loadu_si256((__m256i*)vector);
+      _mm256_storeu_si256((__m256i*)vector, _mm256_sll_epi32(v, shift));
+    }
+    len &= 7;
+#endif
+    for (i = len>>2; i--; vector+=4) {
+      __m128i v = _mm_loadu_si128((__m128i*)vector);
+      _mm_storeu_si128((__m128i*)vector, _mm_sll_epi32(v, shift));
+    }
+    for (i = len&3; i--; ) {
+      *(vector++) <<= scalefactor;
+    }
+  } else {
+    INT negScalefactor = fixmin_I(-scalefactor,(INT)DFRACT_BITS-1);
+    __m128i shift = _mm_cvtsi32_si128(negScalefactor);
+#if defined(__AVX2__)
+    for (i = len>>3; i--; vector+=8) {
+      __m256i v = _mm256_loadu_si256((__m256i*)vector);
+      _mm256_storeu_si256((__m256i*)vector, _mm256_sra_epi32(v, shift));
+    }
+    len &= 7;
+#endif
+    for (i = len>>2; i--; vector+=4) {
+      __m128i v = _mm_loadu_si128((__m128i*)vector);
+      _mm_storeu_si128((__m128i*)vector, _mm_sra_epi32(v, shift));
+    }
+    for (i = len&3; i--; ) {
+      *(vector++) >>= negScalefactor;
+    }
+  }
+}
+
+#define FUNCTION_scaleValues_DBLDBL
+SCALE_INLINE
+void scaleValues(FIXP_DBL *dst,       /*!< dst Vector */
+                 const FIXP_DBL *src, /*!< src Vector */
+                 INT len,             /*!< Length */
+                 INT scalefactor      /*!< Scalefactor */
+                )
+{
+  INT i;
+
+  /* Return if scalefactor is Zero */
+  if (scalefactor==0) {
+    if (dst != src)
+      FDKmemmove(dst, src, len*sizeof(FIXP_DBL));
+  }
+  else {
+    /* Lanes are loaded before they are stored, so dst == src is fine. Partially
+       overlapping buffers are not supported (same as for the generic code). */
+    if(scalefactor > 0){
+      scalefactor = fixmin_I(scalefactor,(INT)DFRACT_BITS-1);
+      __m128i shift = _mm_cvtsi32_si128(scalefactor);
+      for (i = len>>2; i--; dst+=4, src+=4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)src);
+        _mm_storeu_si128((__m128i*)dst, _mm_sll_epi32(v, shift));
+      }
+      for (i = len&3; i--; ) {
+        *(dst++) = *(src++) << scalefactor;
+      }
+    } else {
+      INT negScalefactor = fixmin_I(-scalefactor,(INT)DFRACT_BITS-1);
+      __m128i shift = _mm_cvtsi32_si128(negScalefactor);
+      for (i = len>>2; i--; dst+=4, src+=4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)src);
+        _mm_storeu_si128((__m128i*)dst, _mm_sra_epi32(v, shift));
+      }
+      for (i = len&3; i--; ) {
+        *(dst++) = *(src++) >> negScalefactor;
+      }
+    }
+  }
+}
+
+#if defined(__SSE4_1__)
+/* Signed 32x32 -> upper 32 bit product of four lanes, i.e. fMultDiv2() */
+static inline __m128i fMultDiv2_x4(const __m128i a, const __m128i b)
+{
+  __m128i even = _mm_mul_epi32(a, b);
+  __m128i odd  = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+  return _mm_blend_epi16(_mm_srli_epi64(even, 32), odd, 0xCC);
+}
+
+#define FUNCTION_scaleValuesWithFactor_DBL
+SCALE_INLINE
+void scaleValuesWithFactor(
+        FIXP_DBL *vector,
+        FIXP_DBL factor,
+        INT len,
+        INT scalefactor
+        )
+{
+  INT i;
+  __m128i vFactor = _mm_set1_epi32(factor);
+
+  /* Compensate fMultDiv2 */
+  scalefactor++;
+
+  if(scalefactor > 0){
+    scalefactor = fixmin_I(scalefactor,(INT)DFRACT_BITS-1);
+    __m128i shift = _mm_cvtsi32_si128(scalefactor);
+    for (i = len>>2; i--; vector+=4) {
+      __m128i v = fMultDiv2_x4(_mm_loadu_si128((__m128i*)vector), vFactor);
+      _mm_storeu_si128((__m128i*)vector, _mm_sll_epi32(v, shift));
+    }
+    for (i = len&3; i--; ) {
+      *vector = fMultDiv2(*vector, factor) << scalefactor;
+      vector++;
+    }
+  } else {
+    INT negScalefactor = fixmin_I(-scalefactor,(INT)DFRACT_BITS-1);
+    __m128i shift = _mm_cvtsi32_si128(negScalefactor);
+    for (i = len>>2; i--; vector+=4) {
+      __m128i v = fMultDiv2_x4(_mm_loadu_si128((__m128i*)vector), vFactor);
+      _mm_storeu_si128((__m128i*)vector, _mm_sra_epi32(v, shift));
+    }
+    for (i = len&3; i--; ) {
+      *vector = fMultDiv2(*vector, factor) >> negScalefactor;
+      vector++;
+    }
+  }
+}
+#endif /* __SSE4_1__ */
+
+#define FUNCTION_getScalefactor_DBL
+SCALE_INLINE
+INT getScalefactor(const FIXP_DBL *vector, /*!< Pointer to input vector */
+                   INT len)                /*!< Length of input vector */
+{
+  INT i;
+  FIXP_DBL temp, maxVal;
+  __m128i vMax = _mm_setzero_si128();
+
+#if defined(__AVX2__)
+  __m256i vMax8 = _mm256_setzero_si256();
+  for (i = len>>3; i--; vector+=8) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)vector);
+    vMax8 = _mm256_or_si256(vMax8, _mm256_xor_si256(v, _mm256_srai_epi32(v, DFRACT_BITS-1)));
+  }
+  vMax = _mm_or_si128(_mm256_castsi256_si128(vMax8), _mm256_extracti128_si256(vMax8, 1));
+  len &= 7;
+#endif
+  for (i = len>>2; i--; vector+=4) {
+    __m128i v = _mm_loadu_si128((const __m128i*)vector);
+    vMax = _mm_or_si128(vMax, _mm_xor_si128(v, _mm_srai_epi32(v, DFRACT_BITS-1)));
+  }
+  vMax = _mm_or_si128(vMax, _mm_shuffle_epi32(vMax, _MM_SHUFFLE(1,0,3,2)));
+  vMax = _mm_or_si128(vMax, _mm_shuffle_epi32(vMax, _MM_SHUFFLE(2,3,0,1)));
+  maxVal = (FIXP_DBL)_mm_cvtsi128_si32(vMax);
+
+  for (i = len&3; i--; ) {
+    temp = (LONG)(*vector++);
+    maxVal |= (FIXP_DBL)((LONG)temp^(LONG)(temp>>(DFRACT_BITS-1)));
+  }
+
+  return fixmax_I((INT)0,(INT)(fixnormz_D(maxVal) - 1));
+}
+
+#define FUNCTION_getScalefactor_SGL
+SCALE_INLINE
+INT getScalefactor(const FIXP_SGL *vector, /*!< Pointer to input vector */
+                   INT len)                /*!< Length of input vector */
+{
+  INT i;
+  SHORT temp, maxVal;
+  __m128i vMax = _mm_setzero_si128();
+
+  for (i = len>>3; i--; vector+=8) {
+    __m128i v = _mm_loadu_si128((const __m128i*)vector);
+    vMax = _mm_or_si128(vMax, _mm_xor_si128(v, _mm_srai_epi16(v, FRACT_BITS-1)));
+  }
+  vMax = _mm_or_si128(vMax, _mm_shuffle_epi32(vMax, _MM_SHUFFLE(1,0,3,2)));
+  vMax = _mm_or_si128(vMax, _mm_shuffle_epi32(vMax, _MM_SHUFFLE(2,3,0,1)));
+  vMax = _mm_or_si128(vMax, _mm_srli_epi32(vMax, 16));
+  maxVal = (SHORT)_mm_cvtsi128_si32(vMax);
+
+  for (i = len&7; i--; ) {
+    temp = (SHORT)(*vector++);
+    maxVal |= (temp^(temp>>(FRACT_BITS-1)));
+  }
+
+  return fixmax_I((INT)0,(INT)(fixnormz_D(FX_SGL2FX_DBL((FIXP_SGL)maxVal)) - 1));
+}
+
+#endif /* __SSE2__ */
+
+#endif /* #ifndef __INCLUDE_SCALE_X86__ */
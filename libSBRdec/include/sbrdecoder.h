@@ -95,6 +95,7 @@ amm-info@iis.fraunhofer.de
 
 #include "FDK_bitstream.h"
 #include "FDK_audio.h"
+#include "FDK_thread.h"
 
 
 #define SBR_DEBUG_EXTHLP "\
@@ -316,6 +317,20 @@ SBR_ERROR sbrDecoder_Apply ( HANDLE_SBRDECODER    self,
                              const int            coreDecodedOk,
                              UCHAR               *psDecoded );
 
+/**
+ * \brief  Select a worker pool for rendering the SBR elements of one frame in parallel.
+ *
+ * Elements are rendered concurrently only if none of them can fail or touch state shared with
+ * other elements, e.g. no PS and no header reset. Otherwise sbrDecoder_Apply() renders them
+ * sequentially. The output is identical in both cases.
+ *
+ * \param self   SBR decoder handle.
+ * \param hPool  Worker pool owned by the caller, or NULL for sequential rendering.
+ * \return  SBRDEC_OK on success, SBRDEC_MEM_ALLOC_FAILED if the work buffers of the workers could not be allocated.
+ */
+SBR_ERROR sbrDecoder_SetWorkerPool ( HANDLE_SBRDECODER      self,
+                                     HANDLE_FDK_WORKERPOOL  hPool );
+
 
 /**
  * \brief       Close SBR decoder instance and free memory.
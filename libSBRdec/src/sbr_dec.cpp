@@ -187,6 +187,32 @@ static void assignTimeSlots( HANDLE_SBR_DEC hSbrDec,                     /*!< ha
   }
 }
 
+/*!
+  \brief Hook other work buffers into a channel, e.g. those of a worker of the pool
+
+  The QMF time slots are re-assigned to the new buffers. The buffers hold no data
+  between calls of sbr_dec(), so nothing has to be copied.
+*/
+void setSbrDecWorkBuffers( HANDLE_SBR_DEC hSbrDec,                     /*!< handle to Decoder channel */
+                           FIXP_DBL *pWorkBuffer1,
+                           FIXP_DBL *pWorkBuffer2,
+                           const int noCols )
+{
+  if ( (hSbrDec->WorkBuffer1 == pWorkBuffer1) && (hSbrDec->WorkBuffer2 == pWorkBuffer2) ) {
+    return;
+  }
+
+  hSbrDec->WorkBuffer1 = pWorkBuffer1;
+  hSbrDec->WorkBuffer2 = pWorkBuffer2;
+
+  if (!hSbrDec->useLP)
+    assignHqTimeSlots( hSbrDec, hSbrDec->QmfBufferReal, hSbrDec->QmfBufferImag, noCols );
+  else
+  {
+    assignLcTimeSlots( hSbrDec, hSbrDec->QmfBufferReal, noCols );
+  }
+}
+
 static void changeQmfType( HANDLE_SBR_DEC hSbrDec,                     /*!< handle to Decoder channel */
                            int useLdTimeAlign )
 {
@@ -401,6 +427,7 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
 
   {
     C_AALLOC_SCRATCH_START(qmfTemp, FIXP_DBL, 2*(64));
+    FDK_PROF_START(tQmf);
 
     qmfAnalysisFiltering( &hSbrDec->AnalysiscQMF,
                            QmfBufferReal + ov_len,
@@ -410,6 +437,7 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
                            strideIn,
                            qmfTemp
                          );
+    FDK_PROF_STOP(FDK_PROF_DEC_SBR_QMF, tQmf);
 
     C_AALLOC_SCRATCH_END(qmfTemp, FIXP_DBL, 2*(64));
   }
@@ -567,6 +595,7 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
 
       {
         C_AALLOC_SCRATCH_START(qmfTemp, FIXP_DBL, 2*(64));
+        FDK_PROF_START(tQmf);
 
         qmfSynthesisFiltering( &hSbrDec->SynthesisQMF,
                                 QmfBufferReal,
@@ -576,6 +605,7 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
                                 timeOut,
                                 strideOut,
                                 qmfTemp);
+        FDK_PROF_STOP(FDK_PROF_DEC_SBR_QMF, tQmf);
 
         C_AALLOC_SCRATCH_END(qmfTemp, FIXP_DBL, 2*(64));
       }
@@ -656,6 +686,7 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
 
 
         {
+          FDK_PROF_START(tPs);
           if ( i == h_ps_d->bsData[h_ps_d->processSlot].mpeg.aEnvStartStop[env] ) {
             initSlotBasedRotation( h_ps_d, env, hHeaderData->freqBandData.highSubband );
             env++;
@@ -666,6 +697,7 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
                       (QmfBufferImag + i),       /* one timeslot of left/mono channel */
                        rQmfReal,                 /* one timeslot or right channel     */
                        rQmfImag);                /* one timeslot or right channel     */
+          FDK_PROF_STOP(FDK_PROF_DEC_PS, tPs);
         }
 
 
@@ -700,6 +732,7 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
         qmfChangeOutScalefactor( synQmfRight, outScalefactorR );
 
         {
+          FDK_PROF_START(tQmf);
 
           qmfSynthesisFilteringSlot( synQmfRight,
                                      rQmfReal,                /* QMF real buffer */
@@ -718,7 +751,7 @@ sbr_dec ( HANDLE_SBR_DEC hSbrDec,            /*!< handle to Decoder channel */
                                      timeOut+(i*synQmf->no_channels*strideOut),
                                      strideOut,
                                      pWorkBuffer);
-
+          FDK_PROF_STOP(FDK_PROF_DEC_SBR_QMF, tQmf);
         }
       } /* no_col loop  i  */
 
@@ -211,4 +211,10 @@ resetSbrDec (HANDLE_SBR_DEC hSbrDec,
              const int useLP,
              const int downsampleFac);
 
+void
+setSbrDecWorkBuffers (HANDLE_SBR_DEC hSbrDec,
+                      FIXP_DBL *pWorkBuffer1,
+                      FIXP_DBL *pWorkBuffer2,
+                      const int noCols);
+
 #endif
@@ -187,6 +187,12 @@ C_ALLOC_MEM(Ram_ps_dec, PS_DEC, 1)
 C_ALLOC_MEM_OVERLAY(Ram_SbrDecWorkBuffer1, FIXP_DBL, ((1024)/(32))*(64), SECT_DATA_L1, WORKBUFFER1_TAG)
 C_ALLOC_MEM_OVERLAY(Ram_SbrDecWorkBuffer2, FIXP_DBL, ((1024)/(32))*(64), SECT_DATA_L2, WORKBUFFER2_TAG)
 
+/*
+   Additional workers of the element-parallel rendering need private scratch memory holding
+   WorkBuffer1 and WorkBuffer2 back to back. Worker 0 uses the buffers above.
+*/
+C_ALLOC_MEM2_SCRATCH(Ram_SbrDecWorkerBuffer, FIXP_DBL, 2*((1024)/(32))*(64), FDK_MAX_WORKERS)
+
 /* @} */
 
 
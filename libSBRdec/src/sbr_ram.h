@@ -124,6 +124,10 @@ struct SBR_DECODER_INSTANCE
   FIXP_DBL *workBuffer1;
   FIXP_DBL *workBuffer2;
 
+  HANDLE_FDK_WORKERPOOL hWorkerPool;           /* element-parallel rendering, owned by the core decoder */
+  FIXP_DBL *workerBuffer1[FDK_MAX_WORKERS];    /* work buffers of each worker, worker 0 uses workBuffer1/2 */
+  FIXP_DBL *workerBuffer2[FDK_MAX_WORKERS];
+
   HANDLE_PS_DEC  hParametricStereoDec;
 
   /* Global parameters */
@@ -154,6 +158,7 @@ H_ALLOC_MEM(Ram_ps_dec, PS_DEC)
 
 H_ALLOC_MEM_OVERLAY(Ram_SbrDecWorkBuffer1, FIXP_DBL)
 H_ALLOC_MEM_OVERLAY(Ram_SbrDecWorkBuffer2, FIXP_DBL)
+H_ALLOC_MEM(Ram_SbrDecWorkerBuffer, FIXP_DBL)
 
 
 #endif /* _SBR_RAM_H_ */
@@ -1308,11 +1308,13 @@ bail:
  * \param numInChannels number of channels from core coder (reading stride).
  * \param numOutChannels pointer to a location to return number of output channels.
  * \param psPossible flag indicating if PS is possible or not.
+ * \param h_ps_d PS decoder handle, NULL if the element is rendered by a worker of the pool.
  * \return SBRDEC_OK if successfull, else error code
  */
 static SBR_ERROR
 sbrDecoder_DecodeElement (
         HANDLE_SBRDECODER    self,
+        HANDLE_PS_DEC        h_ps_d,
         INT_PCM             *timeData,
         const int            interleaved,
         const UCHAR         *channelMapping,
@@ -1325,7 +1327,6 @@ sbrDecoder_DecodeElement (
   SBR_DECODER_ELEMENT *hSbrElement = self->pSbrElement[elementIndex];
   HANDLE_SBR_CHANNEL    *pSbrChannel = self->pSbrElement[elementIndex]->pSbrChannel;
   HANDLE_SBR_HEADER_DATA hSbrHeader = &self->sbrHeader[elementIndex][hSbrElement->useHeaderSlot[hSbrElement->useFrameSlot]];
-  HANDLE_PS_DEC h_ps_d = self->hParametricStereoDec;
 
   /* get memory for frame data from scratch */
   SBR_FRAME_DATA *hFrameDataLeft  = &hSbrElement->pSbrChannel[0]->frameData[hSbrElement->useFrameSlot];
@@ -1541,6 +1542,124 @@ sbrDecoder_DecodeElement (
 }
 
 
+/* Context of the element-parallel SBR rendering */
+typedef struct
+{
+  HANDLE_SBRDECODER  self;
+  INT_PCM           *timeData;
+  int                interleaved;
+  int                numInChannels;
+  const UCHAR       *channelMapping[(8)];  /* channel offsets of each element */
+  SBR_ERROR          errorStatus[(8)];
+} SBR_DECODE_ELEMENT_JOB;
+
+/**
+ * \brief Hook work buffers into all channels of an SBR element.
+ */
+static void sbrDecoder_SetElementWorkBuffers (
+        HANDLE_SBRDECODER  self,
+        const int          elementIndex,
+        FIXP_DBL          *pWorkBuffer1,
+        FIXP_DBL          *pWorkBuffer2
+        )
+{
+  SBR_DECODER_ELEMENT *hSbrElement = self->pSbrElement[elementIndex];
+  HANDLE_SBR_HEADER_DATA hSbrHeader = &self->sbrHeader[elementIndex][hSbrElement->useHeaderSlot[hSbrElement->useFrameSlot]];
+  int numElementChan = (hSbrElement->elementID == ID_CPE) ? 2 : 1;
+  int ch;
+
+  for (ch = 0; ch < numElementChan; ch++) {
+    setSbrDecWorkBuffers( &hSbrElement->pSbrChannel[ch]->SbrDec,
+                           pWorkBuffer1,
+                           pWorkBuffer2,
+                           hSbrHeader->numberTimeSlots * hSbrHeader->timeStep );
+  }
+}
+
+/**
+ * \brief Render one SBR element on a worker of the pool using the work buffers of that worker.
+ */
+static void sbrDecoder_DecodeElementJob (void *pCtx, INT el, INT worker)
+{
+  SBR_DECODE_ELEMENT_JOB *job = (SBR_DECODE_ELEMENT_JOB*)pCtx;
+  HANDLE_SBRDECODER self = job->self;
+  int numElementChan = (self->pSbrElement[el]->elementID == ID_CPE) ? 2 : 1;
+
+  sbrDecoder_SetElementWorkBuffers(self, el, self->workerBuffer1[worker], self->workerBuffer2[worker]);
+
+  job->errorStatus[el] = sbrDecoder_DecodeElement (
+                                 self,
+                                 NULL,
+                                 job->timeData,
+                                 job->interleaved,
+                                 job->channelMapping[el],
+                                 el,
+                                 job->numInChannels,
+                                &numElementChan,
+                                 0
+                               );
+}
+
+/**
+ * \brief Check whether the SBR elements of the current frame can be rendered in parallel. This
+ *        requires that sbrDecoder_DecodeElement() neither fails nor (re)initializes any of the
+ *        elements, so that skipping the elements behind a failing one is never required.
+ * \param self SBR decoder handle
+ * \param channelMapping channel offsets of the first element.
+ * \param numCoreChannels number of channels from core coder.
+ * \param pJob job context receiving the channel offsets of each element.
+ * \return number of elements to render, 0 if the elements must be rendered sequentially.
+ */
+static int sbrDecoder_GetParallelElements (
+        HANDLE_SBRDECODER        self,
+        const UCHAR             *channelMapping,
+        const int                numCoreChannels,
+        SBR_DECODE_ELEMENT_JOB  *pJob
+        )
+{
+  int el, numSbrChannels = 0;
+  UINT usedChannels = 0;
+
+  if (self->flags & SBRDEC_FLUSH) {
+    return 0;
+  }
+
+  for (el = 0; el < self->numSbrElements; el++)
+  {
+    SBR_DECODER_ELEMENT *hSbrElement = self->pSbrElement[el];
+    HANDLE_SBR_HEADER_DATA hSbrHeader = &self->sbrHeader[el][hSbrElement->useHeaderSlot[hSbrElement->useFrameSlot]];
+    int stereo = (hSbrElement->elementID == ID_CPE) ? 1 : 0;
+    int ch;
+
+    if ( (hSbrHeader->syncState == SBR_NOT_INITIALIZED)
+      || (hSbrHeader->status & SBRDEC_HDR_STAT_RESET) ) {
+      return 0;
+    }
+    /* Each element must write its own channels only */
+    for (ch = 0; ch <= stereo; ch++) {
+      if ( (channelMapping[ch] >= numCoreChannels) || (usedChannels & (1<<channelMapping[ch])) ) {
+        return 0;
+      }
+      usedChannels |= 1<<channelMapping[ch];
+    }
+    if ( !hSbrElement->pSbrChannel[0]->SbrDec.LppTrans.pSettings
+      || (stereo && !hSbrElement->pSbrChannel[1]->SbrDec.LppTrans.pSettings) ) {
+      return 0;
+    }
+
+    pJob->channelMapping[el] = channelMapping;
+    numSbrChannels += stereo + 1;
+    channelMapping += stereo + 1;
+
+    if (numSbrChannels >= numCoreChannels) {
+      return el + 1;
+    }
+  }
+
+  return el;
+}
+
+
 SBR_ERROR sbrDecoder_Apply ( HANDLE_SBRDECODER   self,
                              INT_PCM            *timeData,
                              int                *numChannels,
@@ -1604,6 +1723,54 @@ SBR_ERROR sbrDecoder_Apply ( HANDLE_SBRDECODER   self,
     self->numFlushedFrames = 0;
   }
 
+  if ( (psPossible == 0)
+    && (self->numSbrElements > 1)
+    && (FDKworkerPoolGetWorkers(self->hWorkerPool) > 1) )
+  {
+    SBR_DECODE_ELEMENT_JOB job;
+    int numElements = sbrDecoder_GetParallelElements(self, channelMapping, numCoreChannels, &job);
+
+    if (numElements > 1)
+    {
+      job.self          = self;
+      job.timeData      = timeData;
+      job.interleaved   = interleaved;
+      job.numInChannels = numCoreChannels;
+
+      for (sbrElementNum = 0; sbrElementNum < numElements; sbrElementNum++) {
+        /* If core signal is bad then force upsampling */
+        if ( ! coreDecodedOk ) {
+          self->pSbrElement[sbrElementNum]->frameErrorFlag[self->pSbrElement[sbrElementNum]->useFrameSlot] = 1;
+        }
+      }
+
+      FDKworkerPoolRun(self->hWorkerPool, sbrDecoder_DecodeElementJob, &job, numElements);
+
+      for (sbrElementNum = 0; sbrElementNum < numElements; sbrElementNum++) {
+        int numElementChan = (self->pSbrElement[sbrElementNum]->elementID == ID_CPE) ? 2 : 1;
+
+        /* Hand the shared work buffers back to the element */
+        sbrDecoder_SetElementWorkBuffers(self, sbrElementNum, self->workBuffer1, self->workBuffer2);
+
+        if ( (errorStatus == SBRDEC_OK) && (job.errorStatus[sbrElementNum] != SBRDEC_OK) ) {
+          errorStatus = job.errorStatus[sbrElementNum];
+        }
+        numSbrChannels += numElementChan;
+      }
+      if (errorStatus != SBRDEC_OK) {
+        goto bail;
+      }
+
+      /* The workers render without PS decoder. Update it as the sequential rendering would. */
+      if (self->hParametricStereoDec != NULL) {
+        self->hParametricStereoDec->procFrameBased = 1;
+        self->hParametricStereoDec->psDecodedPrv = 0;
+      }
+
+      goto done;
+    }
+  }
+
   /* Loop over SBR elements */
   for (sbrElementNum = 0; sbrElementNum<self->numSbrElements; sbrElementNum++)
   {
@@ -1623,6 +1790,7 @@ SBR_ERROR sbrDecoder_Apply ( HANDLE_SBRDECODER   self,
 
     errorStatus = sbrDecoder_DecodeElement (
                                  self,
+                                 self->hParametricStereoDec,
                                  timeData,
                                  interleaved,
                                  channelMapping,
@@ -1644,6 +1812,7 @@ SBR_ERROR sbrDecoder_Apply ( HANDLE_SBRDECODER   self,
     }
   }
 
+done:
   /* Update numChannels and samplerate */
   *numChannels = numSbrChannels;
   *sampleRate = self->sampleRateOut;
@@ -1661,6 +1830,39 @@ bail:
 }
 
 
+SBR_ERROR sbrDecoder_SetWorkerPool ( HANDLE_SBRDECODER      self,
+                                     HANDLE_FDK_WORKERPOOL  hPool )
+{
+  int n, nWorkers = FDKworkerPoolGetWorkers(hPool);
+
+  if (self == NULL) {
+    return SBRDEC_NOT_INITIALIZED;
+  }
+
+  self->hWorkerPool = NULL;
+  self->workerBuffer1[0] = self->workBuffer1;
+  self->workerBuffer2[0] = self->workBuffer2;
+
+  for (n = 1; n < FDK_MAX_WORKERS; n++) {
+    if ( (n < nWorkers) && (self->workerBuffer1[n] == NULL) ) {
+      self->workerBuffer1[n] = GetRam_SbrDecWorkerBuffer(n);
+      if (self->workerBuffer1[n] == NULL) {
+        return SBRDEC_MEM_ALLOC_FAILED;
+      }
+      self->workerBuffer2[n] = self->workerBuffer1[n] + ((1024)/(32))*(64);
+    }
+    if ( (n >= nWorkers) && (self->workerBuffer1[n] != NULL) ) {
+      FreeRam_SbrDecWorkerBuffer(&self->workerBuffer1[n]);
+      self->workerBuffer2[n] = NULL;
+    }
+  }
+
+  self->hWorkerPool = hPool;
+
+  return SBRDEC_OK;
+}
+
+
 SBR_ERROR sbrDecoder_Close ( HANDLE_SBRDECODER *pSelf )
 {
   HANDLE_SBRDECODER self = *pSelf;
@@ -1678,6 +1880,11 @@ SBR_ERROR sbrDecoder_Close ( HANDLE_SBRDECODER *pSelf )
     if (self->workBuffer2 != NULL) {
       FreeRam_SbrDecWorkBuffer2(&self->workBuffer2);
     }
+    for (i = 1; i < FDK_MAX_WORKERS; i++) {
+      if (self->workerBuffer1[i] != NULL) {
+        FreeRam_SbrDecWorkerBuffer(&self->workerBuffer1[i]);
+      }
+    }
 
     for (i = 0; i < (8); i++) {
       sbrDecoder_DestroyElement( self, i );
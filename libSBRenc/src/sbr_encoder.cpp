@@ -1287,6 +1287,14 @@ initEnvChannel (  HANDLE_SBR_CONFIG_DATA sbrConfigData,
 
   hEnv->fLevelProtect = 0;
 
+  if (statesInitFlag) {
+    /* QMF energy scale and tonality of the previous frames */
+    hEnv->qmfScale = 0;
+    hEnv->encEnvData.ton_HF[0] = FL2FXCONST_DBL(0.0f);
+    hEnv->encEnvData.ton_HF[1] = FL2FXCONST_DBL(0.0f);
+    hEnv->encEnvData.global_tonality = FL2FXCONST_DBL(0.0f);
+  }
+
   hEnv->encEnvData.ldGrid = (sbrConfigData->sbrSyntaxFlags & SBR_SYNTAX_LOW_DELAY) ? 1 : 0;
 
   hEnv->encEnvData.sbr_xpos_mode = (XPOS_MODE)params->sbr_xpos_mode;
@@ -93,7 +93,7 @@ amm-info@iis.fraunhofer.de
 #include "sbr.h"
 #include "genericStds.h"
 
-C_ALLOC_MEM (Ram_SbrDynamic_RAM, FIXP_DBL, ((SBR_ENC_DYN_RAM_SIZE)/sizeof(FIXP_DBL)))
+C_ALLOC_MEM_SCRATCH (Ram_SbrDynamic_RAM, FIXP_DBL, ((SBR_ENC_DYN_RAM_SIZE)/sizeof(FIXP_DBL)))
 
 /*!
   \name StaticSbrData
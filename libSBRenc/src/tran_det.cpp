@@ -813,8 +813,11 @@ INT FDKsbrEnc_InitSbrFastTransientDetector(
 
   for(i=0; i< buff_size; i++) {
     h_sbrFastTransientDetector->delta_energy[i] = FL2FXCONST_DBL(0.0f);
+    h_sbrFastTransientDetector->delta_energy_scale[i] = 0;
     h_sbrFastTransientDetector->energy_timeSlots[i] = FL2FXCONST_DBL(0.0f);
+    h_sbrFastTransientDetector->energy_timeSlots_scale[i] = 0;
     h_sbrFastTransientDetector->lowpass_energy[i] = FL2FXCONST_DBL(0.0f);
+    h_sbrFastTransientDetector->lowpass_energy_scale[i] = 0;
     h_sbrFastTransientDetector->transientCandidates[i] = 0;
   }
 
@@ -0,0 +1,173 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2013 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+/**************************  Fraunhofer IIS FDK SysLib  **********************
+
+   Author(s):
+
+******************************************************************************/
+
+/** \file   FDK_arena.h
+    \brief  Memory arena for the dynamic memory of one codec instance.
+
+    An arena manages one contiguous memory block provided by the application. While an arena is
+    bound to the calling thread with FDKarenaBind(), FDKcalloc(), FDKmalloc() and FDKaalloc() and
+    thus all C_ALLOC_MEM family functions carve their memory out of this block instead of the heap,
+    and FDKfree() returns memory to it. A codec instance opened within a sufficiently large arena
+    therefore needs no heap allocation at all. If the arena is exhausted, the allocation functions
+    fall back to the heap.
+
+    The block size needed for a given sequence of allocations is determined with a measuring arena.
+    A measuring arena takes its memory from the heap and records the peak memory consumption
+    including all arena overhead. FDKarenaGetRequiredSize() converts this peak into the size of a
+    block which serves the same allocation sequence.
+
+    The binding is per thread. Arenas must not be shared by threads working concurrently.
+ */
+
+#if !defined(__FDK_ARENA_H__)
+#define __FDK_ARENA_H__
+
+#include "machine_type.h"
+
+typedef struct FDK_ARENA
+{
+  UCHAR *pBase;   /*!< First memory block of the arena, NULL for a measuring arena. */
+  UINT   size;    /*!< Size of the memory area at pBase in bytes. */
+  UINT   used;    /*!< Bytes currently in use including block headers. */
+  UINT   peak;    /*!< Maximum of used since arena creation. */
+} FDK_ARENA;
+
+typedef FDK_ARENA *HANDLE_FDK_ARENA;
+
+/**
+ * \brief Create an arena within an application memory block.
+ * \param pMem  Memory block. The arena control structure is placed at its start.
+ * \param size  Size of the memory block in bytes.
+ * \return Arena handle, or NULL if the block is too small.
+ */
+HANDLE_FDK_ARENA FDKarenaCreate(void *pMem, const UINT size);
+
+/**
+ * \brief Initialize a measuring arena.
+ * \param hArena  Arena structure provided by the caller.
+ */
+void FDKarenaInitMeasure(HANDLE_FDK_ARENA hArena);
+
+/**
+ * \brief Get the memory block size needed to serve the allocations observed by an arena.
+ * \param hArena  Arena handle, usually of a measuring arena.
+ * \return Block size in bytes to be passed to FDKarenaCreate().
+ */
+UINT FDKarenaGetRequiredSize(const HANDLE_FDK_ARENA hArena);
+
+/**
+ * \brief Bind an arena to the calling thread.
+ * \param hArena  Arena handle, or NULL to return to heap allocation.
+ * \return Previously bound arena, to be restored with a further call to FDKarenaBind().
+ */
+HANDLE_FDK_ARENA FDKarenaBind(HANDLE_FDK_ARENA hArena);
+
+/**
+ * \brief Get the arena bound to the calling thread.
+ * \return Arena handle or NULL.
+ */
+HANDLE_FDK_ARENA FDKarenaGetBound(void);
+
+/**
+ * \brief Allocate and clear memory from an arena.
+ * \param hArena  Arena handle.
+ * \param size    Number of bytes.
+ * \return Pointer to memory, or NULL if the arena is exhausted.
+ */
+void *FDKarenaAlloc(HANDLE_FDK_ARENA hArena, const UINT size);
+
+/**
+ * \brief Return memory to an arena.
+ * \param hArena  Arena handle, may be NULL.
+ * \param ptr     Memory as returned by FDKarenaAlloc().
+ * \return 1 if the memory belonged to the arena, 0 otherwise.
+ */
+INT FDKarenaFree(HANDLE_FDK_ARENA hArena, void *ptr);
+
+#endif /* __FDK_ARENA_H__ */
@@ -0,0 +1,154 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2013 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+/**************************  Fraunhofer IIS FDK SysLib  **********************
+
+   Author(s):
+
+******************************************************************************/
+
+/** \file   FDK_thread.h
+    \brief  Minimal fork/join worker pool.
+
+    A worker pool executes a batch of independent jobs on up to FDK_MAX_WORKERS threads and
+    returns when all jobs of the batch are finished. The calling thread always participates as
+    worker 0, so a pool with one worker (or no pool at all) processes the batch sequentially in
+    job order without any synchronization overhead.
+
+    Every job receives the index of the worker executing it. Callers use this index to select
+    per-worker scratch memory. Jobs of one batch must not depend on each other. Timing statistics
+    of a job are added to the structure FDKprofileBind() selected on the calling thread, offset by
+    the worker index.
+
+    On platforms without POSIX threads, or if FDK_DISABLE_THREADS is defined, the pool is
+    limited to one worker.
+ */
+
+#if !defined(__FDK_THREAD_H__)
+#define __FDK_THREAD_H__
+
+#include "machine_type.h"
+
+#define FDK_MAX_WORKERS  ( 8 )  /*!< Maximum number of workers including the calling thread. */
+
+/**
+ * \brief Job callback.
+ * \param pCtx       Context pointer as given to FDKworkerPoolRun().
+ * \param jobIdx     Index of the job within the batch, 0 ... nJobs-1.
+ * \param workerIdx  Index of the executing worker, 0 ... FDKworkerPoolGetWorkers()-1.
+ */
+typedef void (*FDK_WORKER_JOB)(void *pCtx, INT jobIdx, INT workerIdx);
+
+typedef struct FDK_WORKERPOOL *HANDLE_FDK_WORKERPOOL;
+
+/**
+ * \brief Create a worker pool.
+ * \param phPool    Pointer to pool handle. Set to NULL if nWorkers is less than 2.
+ * \param nWorkers  Requested number of workers including the calling thread.
+ * \return 0 on success, -1 if the threads could not be created.
+ */
+INT FDKworkerPoolOpen(HANDLE_FDK_WORKERPOOL *phPool, INT nWorkers);
+
+/**
+ * \brief Get number of workers of a pool including the calling thread.
+ * \param hPool  Pool handle, may be NULL.
+ * \return Number of workers, at least 1.
+ */
+INT FDKworkerPoolGetWorkers(HANDLE_FDK_WORKERPOOL hPool);
+
+/**
+ * \brief Execute job(pCtx, 0 ... nJobs-1, workerIdx) and wait until all jobs are finished.
+ * \param hPool  Pool handle. If NULL the jobs are executed sequentially by the calling thread.
+ * \param job    Job callback.
+ * \param pCtx   Context pointer handed to each job.
+ * \param nJobs  Number of jobs in this batch.
+ */
+void FDKworkerPoolRun(HANDLE_FDK_WORKERPOOL hPool, FDK_WORKER_JOB job, void *pCtx, INT nJobs);
+
+/**
+ * \brief Terminate all worker threads and free the pool.
+ * \param phPool  Pointer to pool handle, set to NULL on return.
+ */
+void FDKworkerPoolClose(HANDLE_FDK_WORKERPOOL *phPool);
+
+#endif /* __FDK_THREAD_H__ */
@@ -129,6 +129,86 @@ typedef enum {
 } MEMORY_SECTION;
 
 
+/**
+ * Storage class specifier for variables that exist once per thread.
+ */
+#if defined(FDK_DISABLE_THREADS)
+  #define FDK_THREAD_LOCAL
+#elif defined(_MSC_VER)
+  #define FDK_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+  #define FDK_THREAD_LOCAL __thread
+#else
+  #define FDK_THREAD_LOCAL
+#endif
+
+/**
+ * Slot of a memory overlay that can be shared between several instances of one thread,
+ * see C_ALLOC_MEM_OVERLAY.
+ */
+typedef struct
+{
+  void *ptr;   /*!< Shared memory area or NULL. */
+  INT   refs;  /*!< Number of instances using ptr. */
+} FDK_SHARED_MEM;
+
+/**
+ * Memory sections reported in ::FDK_MEM_INFO.
+ */
+typedef enum
+{
+  FDK_MEM_SECT_L1 = 0,   /*!< Internal memory requested as SECT_DATA_L1*. */
+  FDK_MEM_SECT_L2,       /*!< Internal memory requested as SECT_DATA_L2. */
+  FDK_MEM_SECT_EXTERN,   /*!< External memory, this includes all memory allocated without section. */
+  FDK_MEM_SECT_COUNT
+
+} FDK_MEM_SECTION;
+
+/**
+ * Memory requirements in bytes per memory section. Persistent memory holds the state of an
+ * instance. Scratch memory only holds data needed within one call into a library and is
+ * allocated with C_ALLOC_MEM_SCRATCH or C_ALLOC_MEM_OVERLAY.
+ */
+typedef struct
+{
+  UINT persistent[FDK_MEM_SECT_COUNT];
+  UINT scratch[FDK_MEM_SECT_COUNT];
+
+} FDK_MEM_INFO;
+
+/**
+ * Processing stages reported in ::FDK_PROF_STATS.
+ */
+typedef enum
+{
+  FDK_PROF_ENC_PSY = 0,  /*!< Encoder psychoacoustic model, including TNS. */
+  FDK_PROF_ENC_TNS,      /*!< Encoder TNS detection and filtering. */
+  FDK_PROF_ENC_QC,       /*!< Encoder quantization and bit distribution. */
+  FDK_PROF_ENC_BITSTREAM,/*!< Encoder bitstream writing of the raw data blocks. */
+  FDK_PROF_ENC_SBR,      /*!< SBR encoder, including parametric stereo. */
+  FDK_PROF_ENC_TRANSPORT,/*!< Encoder transport frame writing. */
+  FDK_PROF_DEC_HUFFMAN,  /*!< Decoder Huffman decoding of the spectral data. */
+  FDK_PROF_DEC_IMDCT,    /*!< Decoder frequency to time conversion. */
+  FDK_PROF_DEC_SBR_QMF,  /*!< SBR decoder QMF analysis and synthesis. */
+  FDK_PROF_DEC_PS,       /*!< Decoder parametric stereo. */
+  FDK_PROF_DEC_DRC,      /*!< Decoder dynamic range control. */
+  FDK_PROF_DEC_LIMITER,  /*!< Decoder time domain limiter. */
+  FDK_PROF_STAGES
+
+} FDK_PROF_STAGE;
+
+/**
+ * Cumulative processing time in nanoseconds and number of calls per processing stage. Only
+ * collected if the library is built with FDK_PROFILE defined.
+ */
+typedef struct
+{
+  UINT64 ns[FDK_PROF_STAGES];
+  UINT   calls[FDK_PROF_STAGES];
+
+} FDK_PROF_STATS;
+
+
 /**
  * The H_ prefix indicates header file version, the C_* prefix indicates the corresponding
  * object version.
@@ -210,10 +290,35 @@ typedef enum {
     void Free ## name(type** p) { if (p != NULL) { FDKafree_L(*p); *p=NULL; } } \
     UINT GetRequiredMem ## name(void) { return ALGN_SIZE_EXTRES((n1) * sizeof(type) + ALIGNMENT_DEFAULT + sizeof(void *)) * (n2); }
 
+  /** Same as C_ALLOC_MEM, but the memory is accounted as scratch memory, see FDKmemMeasure(). */
+  #define C_ALLOC_MEM_SCRATCH(name,type,num) \
+    type * Get ## name(int n) { FDK_ASSERT((n) == 0); return ((type*)FDKcalloc_Scratch(num, sizeof(type))); } \
+    void Free ## name(type** p) { if (p != NULL) { FDKfree(*p); *p=NULL; } } \
+    UINT GetRequiredMem ## name(void) { return ALGN_SIZE_EXTRES((num) * sizeof(type)); }
+
+  /** Same as C_ALLOC_MEM2, but the memory is accounted as scratch memory, see FDKmemMeasure(). */
+  #define C_ALLOC_MEM2_SCRATCH(name,type,n1,n2) \
+    type * Get ## name (int n) { FDK_ASSERT((n) < (n2)); return ((type*)FDKcalloc_Scratch(n1, sizeof(type))); } \
+    void Free ## name(type** p) { if (p != NULL) { FDKfree(*p); *p=NULL; } } \
+    UINT GetRequiredMem ## name(void) { return ALGN_SIZE_EXTRES((n1) * sizeof(type)) * (n2); }
+
+  /** Same as C_AALLOC_MEM, but the memory is accounted as scratch memory, see FDKmemMeasure(). */
+  #define C_AALLOC_MEM_SCRATCH(name,type,num) \
+    type * Get ## name(int n) { FDK_ASSERT((n) == 0); return ((type*)FDKaalloc_Scratch((num)*sizeof(type), ALIGNMENT_DEFAULT)); } \
+    void Free ## name(type** p) { if (p != NULL) { FDKafree(*p); *p=NULL; } } \
+    UINT GetRequiredMem ## name(void) { return ALGN_SIZE_EXTRES((num) * sizeof(type) + ALIGNMENT_DEFAULT + sizeof(void *)); }
+
 /** See #H_ALLOC_MEM_OVERLAY for description. */
 
 
-  #define C_ALLOC_MEM_OVERLAY(name,type,num,sect,tag) C_AALLOC_MEM_L(name,type,num,sect)
+  /* Overlays only hold data that is not needed beyond one call into the library. If the
+     calling thread enabled sharing with FDKsetSharedOverlays(), all instances opened on that
+     thread use the same memory area for an overlay, otherwise each instance gets its own. */
+  #define C_ALLOC_MEM_OVERLAY(name,type,num,sect,tag) \
+    static FDK_THREAD_LOCAL FDK_SHARED_MEM _shared ## name; \
+    type * Get ## name(int n) { FDK_ASSERT((n) == 0); return ((type*)FDKaalloc_Shared(&_shared ## name, (num)*sizeof(type), ALIGNMENT_DEFAULT, sect)); } \
+    void Free ## name(type** p) { if (p != NULL) { FDKafree_Shared(&_shared ## name, *p); *p=NULL; } } \
+    UINT GetRequiredMem ## name(void) { return ALGN_SIZE_EXTRES((num) * sizeof(type) + ALIGNMENT_DEFAULT + sizeof(void *)); }
 
 
    #define C_AALLOC_SCRATCH_START(name,type,n) \
@@ -309,6 +414,99 @@ void  FDKfree_L(void *ptr);
  */
 void  FDKafree_L(void *ptr);
 
+/**
+ *  Allocate and clear memory that only holds data needed within one call into a library.
+ *  Same as FDKcalloc(), but accounted as scratch memory by FDKmemMeasure().
+ */
+void *FDKcalloc_Scratch(const UINT n, const UINT size);
+
+/**
+ *  Allocate aligned scratch memory, see FDKcalloc_Scratch(). Use FDKafree() to free it.
+ */
+void *FDKaalloc_Scratch(const UINT size, const UINT alignment);
+
+/**
+ *  Start or stop accounting of the memory allocated by the calling thread. While accounting
+ *  is active, the size of every allocation is added to the given structure, depending on its
+ *  memory section and whether it is scratch memory. Memory areas taken from an already
+ *  allocated shared overlay are not accounted.
+ *
+ * \param pMemInfo  Structure to be cleared and used for accounting, or NULL to stop accounting.
+ * \return          Structure used for accounting before the call, or NULL.
+ */
+FDK_MEM_INFO *FDKmemMeasure(FDK_MEM_INFO *pMemInfo);
+
+/**
+ *  Enable or disable sharing of memory overlays for all instances subsequently opened by the
+ *  calling thread. Sharing is disabled by default.
+ *
+ * \param enable  0: each instance allocates its own overlays, 1: instances share overlays.
+ * \return        Previous setting.
+ */
+INT   FDKsetSharedOverlays(const INT enable);
+
+/**
+ *  Allocate aligned memory for an overlay. If sharing is enabled for the calling thread, the
+ *  memory area of the given slot is reused and its reference count is incremented, otherwise
+ *  FDKaalloc_L() is called.
+ *
+ * \param pSlot      Per-thread slot of the overlay.
+ * \param size       Size of requested memory in bytes.
+ * \param alignment  Alignment of requested memory in bytes.
+ * \param s          Memory section.
+ * \return           Pointer to allocated memory.
+ */
+void *FDKaalloc_Shared(FDK_SHARED_MEM *pSlot, const UINT size, const UINT alignment, MEMORY_SECTION s);
+
+/**
+ *  Release memory obtained with FDKaalloc_Shared(). A shared area is freed when its last user
+ *  releases it.
+ */
+void  FDKafree_Shared(FDK_SHARED_MEM *pSlot, void *ptr);
+
+/**
+ *  Select the structure the calling thread adds the processing time of the stages timed with
+ *  FDK_PROF_START() and FDK_PROF_STOP() to. Jobs run by a worker pool add to the structure
+ *  following the bound one by the index of the worker, so an instance binds the first of an
+ *  array of ::FDK_MAX_WORKERS structures.
+ *
+ * \param pStats  Structure to accumulate into, or NULL to stop accumulating.
+ * \return        Structure bound before the call, or NULL.
+ */
+FDK_PROF_STATS *FDKprofileBind(FDK_PROF_STATS *pStats);
+
+/**
+ *  Add the statistics of several structures to another one.
+ *
+ * \param pSum    Structure to add to.
+ * \param pStats  Structures to be added.
+ * \param n       Number of structures.
+ */
+void  FDKprofileAccumulate(FDK_PROF_STATS *pSum, const FDK_PROF_STATS *pStats, const INT n);
+
+/**
+ *  Get a monotonic time stamp in nanoseconds.
+ */
+UINT64 FDKprofileNow(void);
+
+/**
+ *  Add the time elapsed since the time stamp start to the given stage of the structure bound
+ *  by the calling thread.
+ */
+void  FDKprofileAdd(const FDK_PROF_STAGE stage, const UINT64 start);
+
+/**
+ * FDK_PROF_START(t) declares the time stamp t at the begin of a timed stage, FDK_PROF_STOP(stage,t)
+ * accounts the stage at its end. Both expand to nothing unless FDK_PROFILE is defined.
+ */
+#if defined(FDK_PROFILE)
+  #define FDK_PROF_START(t)       UINT64 t = FDKprofileNow()
+  #define FDK_PROF_STOP(stage,t)  FDKprofileAdd(stage, t)
+#else
+  #define FDK_PROF_START(t)
+  #define FDK_PROF_STOP(stage,t)
+#endif
+
 
 /**
  * Copy memory. Source and destination memory must not overlap.
@@ -149,6 +149,10 @@ amm-info@iis.fraunhofer.de
  */
 /** \var  INT_PCM
  *        Data type representing the width of input and output PCM samples.
+ *        By default PCM samples are 16 bit wide. If FDK_PCM_BITS is defined to 32, the library exchanges
+ *        32 bit PCM samples and the decoder output keeps the precision of the internal fixed point
+ *        processing. 24 bit audio data is represented left-aligned within the 32 bit samples.
+ *        Applications must be compiled with the same FDK_PCM_BITS setting as the library.
  */
 
 
@@ -197,11 +201,19 @@ amm-info@iis.fraunhofer.de
   #define FDK_ASSERT(ignore)
 #endif
 
+#if defined(FDK_PCM_BITS) && (FDK_PCM_BITS == 32)
+  typedef LONG         INT_PCM;
+  #define WAV_BITS     16
+  #define SAMPLE_BITS  32
+  #define SAMPLE_MAX ((LONG)0x7FFFFFFF)
+  #define SAMPLE_MIN (~SAMPLE_MAX)
+#else
   typedef SHORT        INT_PCM;
   #define WAV_BITS     16
   #define SAMPLE_BITS  16
   #define SAMPLE_MAX (((LONG)1<<(SAMPLE_BITS-1))-1)
   #define SAMPLE_MIN (~SAMPLE_MAX)
+#endif
 
 /*!
 * \def    RAM_ALIGN
@@ -0,0 +1,256 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2015 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+/**************************  Fraunhofer IIS FDK SysLib  **********************
+
+   Author(s):
+   Description: Memory arena with first fit block allocation.
+
+******************************************************************************/
+
+#include "FDK_arena.h"
+#include "genericStds.h"
+
+#include <stdlib.h>
+
+#define ARENA_ALIGN   ( 8 )
+#define ARENA_ROUND(x) ( ((x) + (ARENA_ALIGN-1)) & ~(UINT)(ARENA_ALIGN-1) )
+
+/* Every block starts with a header. The block size includes the header. */
+typedef struct
+{
+  UINT size;
+  UINT isFree;
+} ARENA_BLOCK;
+
+#define ARENA_HDR_SIZE    ARENA_ROUND(sizeof(ARENA_BLOCK))
+#define ARENA_CTRL_SIZE   ARENA_ROUND(sizeof(FDK_ARENA))
+
+static FDK_THREAD_LOCAL HANDLE_FDK_ARENA fdkBoundArena = NULL;
+
+
+HANDLE_FDK_ARENA FDKarenaCreate(void *pMem, const UINT size)
+{
+  HANDLE_FDK_ARENA hArena;
+  UCHAR *pStart, *pEnd;
+  ARENA_BLOCK *pBlock;
+
+  if (pMem == NULL) {
+    return NULL;
+  }
+
+  pStart = (UCHAR*)(((size_t)pMem + (ARENA_ALIGN-1)) & ~(size_t)(ARENA_ALIGN-1));
+  pEnd   = (UCHAR*)pMem + size;
+
+  if ( (pEnd < pStart) || ((UINT)(pEnd-pStart) < ARENA_CTRL_SIZE + 2*ARENA_HDR_SIZE) ) {
+    return NULL;
+  }
+
+  hArena = (HANDLE_FDK_ARENA)pStart;
+  hArena->pBase = pStart + ARENA_CTRL_SIZE;
+  hArena->size  = (UINT)(pEnd - hArena->pBase) & ~(UINT)(ARENA_ALIGN-1);
+  hArena->used  = 0;
+  hArena->peak  = 0;
+
+  /* One free block covering the whole arena. */
+  pBlock = (ARENA_BLOCK*)hArena->pBase;
+  pBlock->size   = hArena->size;
+  pBlock->isFree = 1;
+
+  return hArena;
+}
+
+void FDKarenaInitMeasure(HANDLE_FDK_ARENA hArena)
+{
+  hArena->pBase = NULL;
+  hArena->size  = 0;
+  hArena->used  = 0;
+  hArena->peak  = 0;
+}
+
+UINT FDKarenaGetRequiredSize(const HANDLE_FDK_ARENA hArena)
+{
+  /* worst case alignment of the application block, control structure and allocations */
+  return (ARENA_ALIGN-1) + ARENA_CTRL_SIZE + hArena->peak;
+}
+
+HANDLE_FDK_ARENA FDKarenaBind(HANDLE_FDK_ARENA hArena)
+{
+  HANDLE_FDK_ARENA hPrev = fdkBoundArena;
+  fdkBoundArena = hArena;
+  return hPrev;
+}
+
+HANDLE_FDK_ARENA FDKarenaGetBound(void)
+{
+  return fdkBoundArena;
+}
+
+void *FDKarenaAlloc(HANDLE_FDK_ARENA hArena, const UINT size)
+{
+  UINT need = ARENA_HDR_SIZE + ARENA_ROUND(size);
+  ARENA_BLOCK *pBlock;
+  UINT offset;
+
+  if (hArena->pBase == NULL) {
+    /* Measuring arena: take memory from heap, keep block header for FDKarenaFree(). */
+    pBlock = (ARENA_BLOCK*)calloc(1, need);
+    if (pBlock == NULL) {
+      return NULL;
+    }
+    pBlock->size   = need;
+    pBlock->isFree = 0;
+  }
+  else {
+    /* First fit */
+    for (offset = 0; offset < hArena->size; offset += pBlock->size) {
+      pBlock = (ARENA_BLOCK*)(hArena->pBase + offset);
+      if ( pBlock->isFree && (pBlock->size >= need) ) {
+        break;
+      }
+    }
+    if (offset >= hArena->size) {
+      return NULL;
+    }
+
+    /* Split off the remainder if it can hold a further allocation. */
+    if (pBlock->size - need >= 2*ARENA_HDR_SIZE) {
+      ARENA_BLOCK *pRest = (ARENA_BLOCK*)((UCHAR*)pBlock + need);
+      pRest->size   = pBlock->size - need;
+      pRest->isFree = 1;
+      pBlock->size  = need;
+    }
+    pBlock->isFree = 0;
+
+    FDKmemclear((UCHAR*)pBlock + ARENA_HDR_SIZE, pBlock->size - ARENA_HDR_SIZE);
+  }
+
+  hArena->used += pBlock->size;
+  if (hArena->used > hArena->peak) {
+    hArena->peak = hArena->used;
+  }
+
+  return (UCHAR*)pBlock + ARENA_HDR_SIZE;
+}
+
+INT FDKarenaFree(HANDLE_FDK_ARENA hArena, void *ptr)
+{
+  ARENA_BLOCK *pBlock, *pNext;
+  UINT offset;
+
+  if ( (hArena == NULL) || (ptr == NULL) ) {
+    return 0;
+  }
+
+  pBlock = (ARENA_BLOCK*)((UCHAR*)ptr - ARENA_HDR_SIZE);
+
+  if (hArena->pBase == NULL) {
+    /* Measuring arena: all memory allocated while it is bound stems from the arena. */
+    hArena->used -= pBlock->size;
+    free(pBlock);
+    return 1;
+  }
+
+  if ( ((UCHAR*)ptr < hArena->pBase) || ((UCHAR*)ptr >= hArena->pBase + hArena->size) ) {
+    return 0;
+  }
+
+  hArena->used  -= pBlock->size;
+  pBlock->isFree = 1;
+
+  /* Merge adjacent free blocks. */
+  for (offset = 0; offset < hArena->size; offset += pBlock->size) {
+    pBlock = (ARENA_BLOCK*)(hArena->pBase + offset);
+    if (pBlock->isFree) {
+      while (offset + pBlock->size < hArena->size) {
+        pNext = (ARENA_BLOCK*)((UCHAR*)pBlock + pBlock->size);
+        if (!pNext->isFree) {
+          break;
+        }
+        pBlock->size += pNext->size;
+      }
+    }
+  }
+
+  return 1;
+}
@@ -0,0 +1,304 @@
+
+/* -----------------------------------------------------------------------------------------------------------
+Software License for The Fraunhofer FDK AAC Codec Library for Android
+
+ Copyright  1995 - 2015 Fraunhofer-Gesellschaft zur Frderung der angewandten Forschung e.V.
+  All rights reserved.
+
+ 1.    INTRODUCTION
+The Fraunhofer FDK AAC Codec Library for Android ("FDK AAC Codec") is software that implements
+the MPEG Advanced Audio Coding ("AAC") encoding and decoding scheme for digital audio.
+This FDK AAC Codec software is intended to be used on a wide variety of Android devices.
+
+AAC's HE-AAC and HE-AAC v2 versions are regarded as today's most efficient general perceptual
+audio codecs. AAC-ELD is considered the best-performing full-bandwidth communications codec by
+independent studies and is widely deployed. AAC has been standardized by ISO and IEC as part
+of the MPEG specifications.
+
+Patent licenses for necessary patent claims for the FDK AAC Codec (including those of Fraunhofer)
+may be obtained through Via Licensing (www.vialicensing.com) or through the respective patent owners
+individually for the purpose of encoding or decoding bit streams in products that are compliant with
+the ISO/IEC MPEG audio standards. Please note that most manufacturers of Android devices already license
+these patent claims through Via Licensing or directly from the patent owners, and therefore FDK AAC Codec
+software may already be covered under those patent licenses when it is used for those licensed purposes only.
+
+Commercially-licensed AAC software libraries, including floating-point versions with enhanced sound quality,
+are also available from Fraunhofer. Users are encouraged to check the Fraunhofer website for additional
+applications information and documentation.
+
+2.    COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification, are permitted without
+payment of copyright license fees provided that you satisfy the following conditions:
+
+You must retain the complete text of this software license in redistributions of the FDK AAC Codec or
+your modifications thereto in source code form.
+
+You must retain the complete text of this software license in the documentation and/or other materials
+provided with redistributions of the FDK AAC Codec or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of the FDK AAC Codec and your
+modifications thereto to recipients of copies in binary form.
+
+The name of Fraunhofer may not be used to endorse or promote products derived from this library without
+prior written permission.
+
+You may not charge copyright license fees for anyone to use, copy or distribute the FDK AAC Codec
+software or your modifications thereto.
+
+Your modified versions of the FDK AAC Codec must carry prominent notices stating that you changed the software
+and the date of any change. For modified versions of the FDK AAC Codec, the term
+"Fraunhofer FDK AAC Codec Library for Android" must be replaced by the term
+"Third-Party Modified Version of the Fraunhofer FDK AAC Codec Library for Android."
+
+3.    NO PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without limitation the patents of Fraunhofer,
+ARE GRANTED BY THIS SOFTWARE LICENSE. Fraunhofer provides no warranty of patent non-infringement with
+respect to this software.
+
+You may use this FDK AAC Codec software or modifications thereto only for purposes that are authorized
+by appropriate patent licenses.
+
+4.    DISCLAIMER
+
+This FDK AAC Codec software is provided by Fraunhofer on behalf of the copyright holders and contributors
+"AS IS" and WITHOUT ANY EXPRESS OR IMPLIED WARRANTIES, including but not limited to the implied warranties
+of merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE for any direct, indirect, incidental, special, exemplary, or consequential damages,
+including but not limited to procurement of substitute goods or services; loss of use, data, or profits,
+or business interruption, however caused and on any theory of liability, whether in contract, strict
+liability, or tort (including negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5.    CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Audio and Multimedia Departments - FDK AAC LL
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+----------------------------------------------------------------------------------------------------------- */
+
+/**************************  Fraunhofer IIS FDK SysLib  **********************
+
+   Author(s):
+   Description: Minimal fork/join worker pool based on POSIX threads.
+
+******************************************************************************/
+
+#include "FDK_thread.h"
+#include "genericStds.h"
+
+#if !defined(FDK_DISABLE_THREADS) && (defined(__unix__) || defined(__APPLE__))
+  #define FDK_USE_PTHREADS
+  #include <pthread.h>
+#endif
+
+
+#if defined(FDK_USE_PTHREADS)
+
+typedef struct
+{
+  HANDLE_FDK_WORKERPOOL hPool;
+  INT                   workerIdx;
+} FDK_WORKER_ARG;
+
+struct FDK_WORKERPOOL
+{
+  INT             nWorkers;                      /* workers including the calling thread */
+  INT             nThreads;                      /* successfully started worker threads */
+
+  pthread_t       thread[FDK_MAX_WORKERS-1];
+  FDK_WORKER_ARG  arg[FDK_MAX_WORKERS-1];        /* thread arguments, owned by the pool */
+  pthread_mutex_t lock;
+  pthread_cond_t  startCond;                     /* signals a new batch or termination */
+  pthread_cond_t  doneCond;                      /* signals the last thread leaving a batch */
+
+  /* current batch, protected by lock */
+  FDK_WORKER_JOB  job;
+  void           *pCtx;
+  INT             nJobs;
+  INT             nextJob;
+  INT             nBusy;                         /* threads not yet finished with current batch */
+  FDK_PROF_STATS *pProf;                         /* statistics bound by the calling thread */
+  UINT            batch;                         /* batch counter */
+  INT             quit;
+};
+
+/* Fetch and execute jobs of the current batch. Must be called with the pool locked. */
+static void FDKworkerPoolDrain(HANDLE_FDK_WORKERPOOL hPool, INT workerIdx)
+{
+  if ( (workerIdx > 0) && (hPool->pProf != NULL) ) {
+    FDKprofileBind(hPool->pProf + workerIdx);
+  }
+  while (hPool->nextJob < hPool->nJobs) {
+    INT jobIdx = hPool->nextJob++;
+    pthread_mutex_unlock(&hPool->lock);
+    hPool->job(hPool->pCtx, jobIdx, workerIdx);
+    pthread_mutex_lock(&hPool->lock);
+  }
+  if (workerIdx > 0) {
+    FDKprofileBind(NULL);
+  }
+}
+
+static void *FDKworkerPoolThread(void *pArg)
+{
+  HANDLE_FDK_WORKERPOOL hPool = ((FDK_WORKER_ARG*)pArg)->hPool;
+  INT workerIdx = ((FDK_WORKER_ARG*)pArg)->workerIdx;
+  UINT batch = 0;                                /* no batch can be issued before the pool is opened */
+
+  pthread_mutex_lock(&hPool->lock);
+  for (;;) {
+    while ( (hPool->batch == batch) && !hPool->quit ) {
+      pthread_cond_wait(&hPool->startCond, &hPool->lock);
+    }
+    if (hPool->quit) {
+      break;
+    }
+    batch = hPool->batch;
+
+    FDKworkerPoolDrain(hPool, workerIdx);
+
+    if (--hPool->nBusy == 0) {
+      pthread_cond_signal(&hPool->doneCond);
+    }
+  }
+  pthread_mutex_unlock(&hPool->lock);
+
+  return NULL;
+}
+
+INT FDKworkerPoolOpen(HANDLE_FDK_WORKERPOOL *phPool, INT nWorkers)
+{
+  HANDLE_FDK_WORKERPOOL hPool;
+  INT i;
+
+  *phPool = NULL;
+
+  if (nWorkers > FDK_MAX_WORKERS) {
+    nWorkers = FDK_MAX_WORKERS;
+  }
+  if (nWorkers < 2) {
+    return 0;
+  }
+
+  hPool = (HANDLE_FDK_WORKERPOOL)FDKcalloc(1, sizeof(struct FDK_WORKERPOOL));
+  if (hPool == NULL) {
+    return -1;
+  }
+
+  pthread_mutex_init(&hPool->lock, NULL);
+  pthread_cond_init(&hPool->startCond, NULL);
+  pthread_cond_init(&hPool->doneCond, NULL);
+
+  hPool->nWorkers = nWorkers;
+
+  for (i = 1; i < nWorkers; i++) {
+    FDK_WORKER_ARG *pArg = &hPool->arg[i-1];
+    pArg->hPool     = hPool;
+    pArg->workerIdx = i;
+    if (pthread_create(&hPool->thread[i-1], NULL, FDKworkerPoolThread, pArg) != 0) {
+      goto bail;
+    }
+    hPool->nThreads++;
+  }
+
+  *phPool = hPool;
+  return 0;
+
+bail:
+  FDKworkerPoolClose(&hPool);
+  return -1;
+}
+
+INT FDKworkerPoolGetWorkers(HANDLE_FDK_WORKERPOOL hPool)
+{
+  return (hPool != NULL) ? hPool->nWorkers : 1;
+}
+
+void FDKworkerPoolRun(HANDLE_FDK_WORKERPOOL hPool, FDK_WORKER_JOB job, void *pCtx, INT nJobs)
+{
+  if ( (hPool == NULL) || (nJobs < 2) ) {
+    INT i;
+    for (i = 0; i < nJobs; i++) {
+      job(pCtx, i, 0);
+    }
+    return;
+  }
+
+  pthread_mutex_lock(&hPool->lock);
+  hPool->job     = job;
+  hPool->pCtx    = pCtx;
+  hPool->nJobs   = nJobs;
+  hPool->nextJob = 0;
+  hPool->nBusy   = hPool->nThreads;
+  hPool->pProf   = FDKprofileBind(NULL);
+  FDKprofileBind(hPool->pProf);
+  hPool->batch++;
+  pthread_cond_broadcast(&hPool->startCond);
+
+  /* calling thread acts as worker 0 */
+  FDKworkerPoolDrain(hPool, 0);
+
+  while (hPool->nBusy > 0) {
+    pthread_cond_wait(&hPool->doneCond, &hPool->lock);
+  }
+  pthread_mutex_unlock(&hPool->lock);
+}
+
+void FDKworkerPoolClose(HANDLE_FDK_WORKERPOOL *phPool)
+{
+  HANDLE_FDK_WORKERPOOL hPool = *phPool;
+  INT i;
+
+  if (hPool == NULL) {
+    return;
+  }
+
+  pthread_mutex_lock(&hPool->lock);
+  hPool->quit = 1;
+  pthread_cond_broadcast(&hPool->startCond);
+  pthread_mutex_unlock(&hPool->lock);
+
+  for (i = 0; i < hPool->nThreads; i++) {
+    pthread_join(hPool->thread[i], NULL);
+  }
+
+  pthread_cond_destroy(&hPool->doneCond);
+  pthread_cond_destroy(&hPool->startCond);
+  pthread_mutex_destroy(&hPool->lock);
+
+  FDKfree(hPool);
+  *phPool = NULL;
+}
+
+#else /* FDK_USE_PTHREADS */
+
+INT FDKworkerPoolOpen(HANDLE_FDK_WORKERPOOL *phPool, INT nWorkers)
+{
+  *phPool = NULL;
+  return 0;
+}
+
+INT FDKworkerPoolGetWorkers(HANDLE_FDK_WORKERPOOL hPool)
+{
+  return 1;
+}
+
+void FDKworkerPoolRun(HANDLE_FDK_WORKERPOOL hPool, FDK_WORKER_JOB job, void *pCtx, INT nJobs)
+{
+  INT i;
+  for (i = 0; i < nJobs; i++) {
+    job(pCtx, i, 0);
+  }
+}
+
+void FDKworkerPoolClose(HANDLE_FDK_WORKERPOOL *phPool)
+{
+  *phPool = NULL;
+}
+
+#endif /* FDK_USE_PTHREADS */
@@ -95,6 +95,7 @@ amm-info@iis.fraunhofer.de
 #include <math.h>
 
 #include "genericStds.h"
+#include "FDK_arena.h"
 
 /* library info */
 #define SYS_LIB_VL0 1
@@ -113,6 +114,7 @@ amm-info@iis.fraunhofer.de
   #include <stdio.h>
   #include <string.h>
     #include <stdarg.h>
+  #include <time.h>
 
 
 /***************************************************************
@@ -204,10 +206,48 @@ char *FDKstrncpy(char *dest, const char *src, UINT n)             { return strnc
  * DYNAMIC MEMORY management (heap)
  *************************************************************************/
 
+static FDK_THREAD_LOCAL FDK_MEM_INFO *fdkMemInfo = NULL;
+static FDK_THREAD_LOCAL INT fdkMemSection = FDK_MEM_SECT_EXTERN;
+static FDK_THREAD_LOCAL INT fdkMemScratch = 0;
+
+FDK_MEM_INFO *FDKmemMeasure(FDK_MEM_INFO *pMemInfo)
+{
+  FDK_MEM_INFO *pPrev = fdkMemInfo;
+
+  if (pMemInfo != NULL) {
+    FDKmemclear(pMemInfo, sizeof(FDK_MEM_INFO));
+  }
+  fdkMemInfo = pMemInfo;
+
+  return pPrev;
+}
+
+static void FDKmemAccount(const UINT size)
+{
+  if (fdkMemInfo != NULL) {
+    if (fdkMemScratch) {
+      fdkMemInfo->scratch[fdkMemSection] += size;
+    } else {
+      fdkMemInfo->persistent[fdkMemSection] += size;
+    }
+  }
+}
+
 #ifndef FUNCTION_FDKcalloc
 void *FDKcalloc (const UINT n, const UINT size)
 {
   void* ptr;
+  HANDLE_FDK_ARENA hArena = FDKarenaGetBound();
+
+  FDKmemAccount(n*size);
+
+  if (hArena != NULL) {
+    ptr = FDKarenaAlloc(hArena, n*size);
+    if (ptr != NULL) {
+      return ptr;
+    }
+    /* arena exhausted, fall back to heap */
+  }
 
   ptr = calloc(n, size);
 
@@ -219,6 +259,17 @@ void *FDKcalloc (const UINT n, const UINT size)
 void *FDKmalloc (const UINT size)
 {
   void* ptr;
+  HANDLE_FDK_ARENA hArena = FDKarenaGetBound();
+
+  FDKmemAccount(size);
+
+  if (hArena != NULL) {
+    ptr = FDKarenaAlloc(hArena, size);
+    if (ptr != NULL) {
+      return ptr;
+    }
+    /* arena exhausted, fall back to heap */
+  }
 
   ptr = malloc(size);
 
@@ -230,6 +281,9 @@ void *FDKmalloc (const UINT size)
 void  FDKfree (void *ptr)
 {
   /* FDKprintf("f, heapSize: %d\n", heapSizeCurr); */
+  if (FDKarenaFree(FDKarenaGetBound(), ptr)) {
+    return;
+  }
   free((INT*)ptr);
 }
 #endif
@@ -274,6 +328,23 @@ void  FDKafree (void *ptr)
 void *FDKcalloc_L(const UINT dim, const UINT size, MEMORY_SECTION s)
 {
   int a_size;
+  void *ptr;
+  INT prevSection = fdkMemSection;
+
+  switch (s) {
+    case SECT_DATA_L1:
+    case SECT_DATA_L1_A:
+    case SECT_DATA_L1_B:
+    case SECT_CONSTDATA_L1:
+      fdkMemSection = FDK_MEM_SECT_L1;
+      break;
+    case SECT_DATA_L2:
+      fdkMemSection = FDK_MEM_SECT_L2;
+      break;
+    default:
+      fdkMemSection = FDK_MEM_SECT_EXTERN;
+      break;
+  }
 
   if (s == SECT_DATA_EXTERN)
     goto fallback;
@@ -287,7 +358,10 @@ void *FDKcalloc_L(const UINT dim, const UINT size, MEMORY_SECTION s)
   //printf("Warning, out of internal memory\n");
 
 fallback:
-  return FDKcalloc(dim, size);
+  ptr = FDKcalloc(dim, size);
+  fdkMemSection = prevSection;
+
+  return ptr;
 }
 #endif /* FUNCTION_FDKcalloc_L */
 
@@ -325,6 +399,134 @@ void  FDKafree_L (void *ptr)
 }
 #endif
 
+void *FDKcalloc_Scratch(const UINT n, const UINT size)
+{
+  void *ptr;
+  INT prevScratch = fdkMemScratch;
+
+  fdkMemScratch = 1;
+  ptr = FDKcalloc(n, size);
+  fdkMemScratch = prevScratch;
+
+  return ptr;
+}
+
+void *FDKaalloc_Scratch(const UINT size, const UINT alignment)
+{
+  void *ptr;
+  INT prevScratch = fdkMemScratch;
+
+  fdkMemScratch = 1;
+  ptr = FDKaalloc(size, alignment);
+  fdkMemScratch = prevScratch;
+
+  return ptr;
+}
+
+static FDK_THREAD_LOCAL INT fdkSharedOverlays = 0;
+
+INT FDKsetSharedOverlays(const INT enable)
+{
+  INT prev = fdkSharedOverlays;
+  fdkSharedOverlays = (enable) ? 1 : 0;
+  return prev;
+}
+
+void *FDKaalloc_Shared(FDK_SHARED_MEM *pSlot, const UINT size, const UINT alignment, MEMORY_SECTION s)
+{
+  INT prevScratch = fdkMemScratch;
+
+  if (!fdkSharedOverlays) {
+    void *ptr;
+    fdkMemScratch = 1;
+    ptr = FDKaalloc_L(size, alignment, s);
+    fdkMemScratch = prevScratch;
+    return ptr;
+  }
+
+  if (pSlot->ptr == NULL) {
+    /* The shared area outlives the instance that triggered its allocation, so it must not
+       be taken from that instance's arena. */
+    HANDLE_FDK_ARENA hPrev = FDKarenaBind(NULL);
+    fdkMemScratch = 1;
+    pSlot->ptr = FDKaalloc_L(size, alignment, s);
+    fdkMemScratch = prevScratch;
+    FDKarenaBind(hPrev);
+    if (pSlot->ptr == NULL) {
+      return NULL;
+    }
+  }
+  pSlot->refs++;
+
+  return pSlot->ptr;
+}
+
+void FDKafree_Shared(FDK_SHARED_MEM *pSlot, void *ptr)
+{
+  if (ptr == NULL) {
+    return;
+  }
+  if (ptr != pSlot->ptr) {
+    FDKafree_L(ptr);         /* Private copy. */
+    return;
+  }
+  if (--pSlot->refs <= 0) {
+    HANDLE_FDK_ARENA hPrev = FDKarenaBind(NULL);
+    FDKafree_L(pSlot->ptr);
+    FDKarenaBind(hPrev);
+    pSlot->ptr  = NULL;
+    pSlot->refs = 0;
+  }
+}
+
+/*************************************************************************
+ * PROFILING
+ *************************************************************************/
+
+static FDK_THREAD_LOCAL FDK_PROF_STATS *fdkProfStats = NULL;
+
+FDK_PROF_STATS *FDKprofileBind(FDK_PROF_STATS *pStats)
+{
+  FDK_PROF_STATS *pPrev = fdkProfStats;
+  fdkProfStats = pStats;
+  return pPrev;
+}
+
+void FDKprofileAccumulate(FDK_PROF_STATS *pSum, const FDK_PROF_STATS *pStats, const INT n)
+{
+  INT i, s;
+
+  for (i = 0; i < n; i++) {
+    for (s = 0; s < FDK_PROF_STAGES; s++) {
+      pSum->ns[s]    += pStats[i].ns[s];
+      pSum->calls[s] += pStats[i].calls[s];
+    }
+  }
+}
+
+#if !defined(FUNCTION_FDKprofileNow)
+UINT64 FDKprofileNow(void)
+{
+#if defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (UINT64)ts.tv_sec * 1000000000 + (UINT64)ts.tv_nsec;
+#else
+  return (UINT64)((double)clock() * 1e9 / CLOCKS_PER_SEC);
+#endif
+}
+#endif
+
+void FDKprofileAdd(const FDK_PROF_STAGE stage, const UINT64 start)
+{
+  FDK_PROF_STATS *pStats = fdkProfStats;
+
+  if (pStats != NULL) {
+    pStats->ns[stage] += FDKprofileNow() - start;
+    pStats->calls[stage]++;
+  }
+}
+
 
 
 /*---------------------------------------------------------------------------------------